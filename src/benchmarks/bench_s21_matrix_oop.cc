@@ -0,0 +1,949 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../s21_basic_matrix.h"
+#include "../s21_decomposition.h"
+#include "../s21_fixed_matrix.h"
+#include "../s21_matrix_arena.h"
+#include "../s21_matrix_batch.h"
+#include "../s21_matrix_io.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_out_of_core.h"
+#include "../s21_sparse_matrix.h"
+#include "../s21_simd.h"
+#include "../s21_strassen.h"
+#include "../s21_thread_pool.h"
+
+static std::atomic<long> matrix_allocations(0);
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  matrix_allocations++;
+  std::size_t align = static_cast<std::size_t>(alignment);
+  void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align);
+  if (!pointer) throw std::bad_alloc();
+  return pointer;
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+static void FillMatrix(S21Matrix& matrix) {
+  for (int i = 0; i < matrix.GetRows(); i++) {
+    for (int j = 0; j < matrix.GetCols(); j++) {
+      matrix(i, j) = (i * 31 + j * 17) % 101 - 50;
+    }
+  }
+}
+
+static void BM_Construct(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    S21Matrix matrix(size, size);
+    benchmark::DoNotOptimize(matrix);
+  }
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+}
+BENCHMARK(BM_Construct)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_Copy(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix source(size, size);
+  FillMatrix(source);
+  for (auto _ : state) {
+    S21Matrix copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+}
+BENCHMARK(BM_Copy)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_Move(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  for (auto _ : state) {
+    S21Matrix moved(std::move(first));
+    first = std::move(second);
+    second = std::move(moved);
+    benchmark::DoNotOptimize(second);
+  }
+}
+BENCHMARK(BM_Move)->RangeMultiplier(16)->Range(16, 4096);
+
+static void BM_SumMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(second);
+  for (auto _ : state) {
+    first.SumMatrix(second);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SumMatrix)->RangeMultiplier(4)->Range(16, 4096);
+
+// Argument 1 selects result = first + second (0) or the one-node lazy
+// expression first.Lazy() + second (1).
+static void BM_SumOperator(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size), result;
+  FillMatrix(first);
+  FillMatrix(second);
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      result = first + second;
+    } else {
+      result = S21Matrix(first.Lazy() + second);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SumOperator)->ArgsProduct({{64, 256, 1024}, {0, 1}});
+
+// Second argument: pool threads; the parallel policy is used throughout.
+static void BM_SumMatrixParallel(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int thread_count = pool.GetThreadCount();
+  pool.SetThreadCount(static_cast<int>(state.range(1)));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(second);
+  for (auto _ : state) {
+    first.SumMatrix(kS21Par, second);
+    benchmark::ClobberMemory();
+  }
+  pool.SetThreadCount(thread_count);
+  state.SetBytesProcessed(state.iterations() * 3 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SumMatrixParallel)->ArgsProduct({{256, 4096}, {1, 2, 4}});
+
+template <double (S21Matrix::*Reduction)(const S21ExecutionPolicy&) const>
+static void BM_Reduction(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int thread_count = pool.GetThreadCount();
+  pool.SetThreadCount(static_cast<int>(state.range(1)));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((matrix.*Reduction)(kS21Par));
+  }
+  pool.SetThreadCount(thread_count);
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+}
+BENCHMARK_TEMPLATE(BM_Reduction, &S21Matrix::Sum)
+    ->ArgsProduct({{256, 4096}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_Reduction, &S21Matrix::FrobeniusNorm)
+    ->ArgsProduct({{256, 4096}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_Reduction, &S21Matrix::NormOne)
+    ->ArgsProduct({{256, 4096}, {1, 4}});
+BENCHMARK_TEMPLATE(BM_Reduction, &S21Matrix::NormInf)
+    ->ArgsProduct({{256, 4096}, {1, 4}});
+
+// Sums a matrix by checked operator(), At, the row spans, the element
+// iterators and the raw data.
+static void BM_ElementAccess(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  const S21Matrix& constant = matrix;
+  for (auto _ : state) {
+    double sum = 0;
+    switch (state.range(1)) {
+      case 0:
+        for (int i = 0; i < size; i++) {
+          for (int j = 0; j < size; j++) sum += constant(i, j);
+        }
+        break;
+      case 1:
+        for (int i = 0; i < size; i++) {
+          for (int j = 0; j < size; j++) sum += constant.At(i, j);
+        }
+        break;
+      case 2:
+        for (int i = 0; i < size; i++) {
+          S21Span<const double> row = constant.Row(i);
+          sum = std::reduce(row.begin(), row.end(), sum);
+        }
+        break;
+      case 3:
+        sum = std::reduce(constant.begin(), constant.end());
+        break;
+      default:
+        sum = std::reduce(constant.Data(),
+                          constant.Data() + size * constant.GetStride());
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+}
+BENCHMARK(BM_ElementAccess)->ArgsProduct({{256, 2048}, {0, 1, 2, 3, 4}});
+
+static void BM_MulNumber(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (auto _ : state) {
+    matrix.MulNumber(-1.0);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+  state.counters["FLOPS"] = benchmark::Counter(
+      1.0 * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MulNumber)->RangeMultiplier(4)->Range(16, 4096);
+
+// Alternates between growing and shrinking by a quarter.
+static void BM_SetRows(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  int other = size + size / 4;
+  for (auto _ : state) {
+    matrix.SetRows(matrix.GetRows() == size ? other : size);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SetRows)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_SetCols(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  int other = size + size / 4;
+  for (auto _ : state) {
+    matrix.SetCols(matrix.GetCols() == size ? other : size);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SetCols)->RangeMultiplier(4)->Range(16, 4096);
+
+// Streams range(0) rows of 64 values into a matrix that starts with one.
+static void BM_AppendRow(benchmark::State& state) {
+  int count = static_cast<int>(state.range(0));
+  std::vector<double> row(64, 1.0);
+  for (auto _ : state) {
+    S21Matrix matrix(1, 64);
+    for (int i = 1; i < count; i++) {
+      matrix.AppendRow(S21Span<const double>(row.data(), row.size()));
+    }
+    benchmark::DoNotOptimize(matrix.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_AppendRow)->RangeMultiplier(8)->Range(64, 32768);
+
+// range(1) is an S21SimdLevel; levels the CPU lacks are skipped.
+static bool SelectSimdLevel(benchmark::State& state) {
+  S21SimdLevel level = static_cast<S21SimdLevel>(state.range(1));
+  if (level > S21GetSupportedSimdLevel()) {
+    state.SkipWithError("Instruction set is not supported");
+    return false;
+  }
+  S21SetSimdLevel(level);
+  return true;
+}
+
+static void SimdLevelArgs(benchmark::internal::Benchmark* benchmark) {
+  for (int size : {64, 512, 2048}) {
+    for (int level = 0; level <= static_cast<int>(S21SimdLevel::kAvx512);
+         level++) {
+      benchmark->Args({size, level});
+    }
+  }
+}
+
+static void BM_SumMatrixSimd(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(second);
+  if (!SelectSimdLevel(state)) return;
+  for (auto _ : state) {
+    first.SumMatrix(second);
+    benchmark::ClobberMemory();
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+  state.SetBytesProcessed(state.iterations() * 3 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_SumMatrixSimd)->Apply(SimdLevelArgs);
+
+static void BM_MulNumberSimd(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  if (!SelectSimdLevel(state)) return;
+  for (auto _ : state) {
+    matrix.MulNumber(1.0);
+    benchmark::ClobberMemory();
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_MulNumberSimd)->Apply(SimdLevelArgs);
+
+static void BM_EqMatrixSimd(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size);
+  FillMatrix(first);
+  S21Matrix second(first);
+  if (!SelectSimdLevel(state)) return;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(first.EqMatrix(second));
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_EqMatrixSimd)->Apply(SimdLevelArgs);
+
+// The operator-heavy unit tests in miniature: many small temporaries.
+static double SmallOperatorWorkload(const S21Matrix& first,
+                                    const S21Matrix& second) {
+  S21Matrix sum = first + second;
+  S21Matrix difference = first - second * 2.0;
+  S21Matrix product = sum * difference;
+  product.MulMatrix(first.Transpose());
+  S21Matrix complements = first.CalcComplements();
+  S21Matrix inverse = first.InverseMatrix();
+  S21Matrix identity = first * inverse;
+  return product(0, 0) + complements(1, 1) + identity.Determinant() +
+         static_cast<double>(identity == complements);
+}
+
+static void BM_SmallOperators(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  bool use_arena = state.range(1) != 0;
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  for (int i = 0; i < size; i++) first(i, i) += 100;
+  S21MatrixArena arena;
+  long allocations = matrix_allocations;
+  for (auto _ : state) {
+    if (use_arena) {
+      S21MatrixArenaScope scope(arena);
+      benchmark::DoNotOptimize(SmallOperatorWorkload(first, second));
+      arena.Reset();
+    } else {
+      benchmark::DoNotOptimize(SmallOperatorWorkload(first, second));
+    }
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(static_cast<double>(matrix_allocations - allocations),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_SmallOperators)->ArgsProduct({{2, 3, 4, 8}, {0, 1}});
+
+template <int N>
+static void BM_FixedInverse(benchmark::State& state) {
+  S21FixedMatrix<N, N> matrix;
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) matrix(i, j) = (i * 31 + j * 17) % 11 - 5;
+    matrix(i, i) += 20;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matrix);
+    S21FixedMatrix<N, N> inverse = matrix.InverseMatrix();
+    benchmark::DoNotOptimize(inverse);
+    benchmark::DoNotOptimize(matrix.Determinant());
+  }
+}
+BENCHMARK(BM_FixedInverse<2>);
+BENCHMARK(BM_FixedInverse<3>);
+BENCHMARK(BM_FixedInverse<4>);
+
+static void BM_DynamicInverse(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) matrix(i, j) = (i * 31 + j * 17) % 11 - 5;
+    matrix(i, i) += 20;
+  }
+  for (auto _ : state) {
+    S21Matrix inverse = matrix.InverseMatrix();
+    benchmark::DoNotOptimize(inverse);
+    benchmark::DoNotOptimize(matrix.Determinant());
+  }
+}
+BENCHMARK(BM_DynamicInverse)->DenseRange(2, 4);
+
+static constexpr int kBatchCount = 4096;
+
+static S21Matrix MakeBatchOperand(int size, int seed) {
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix(i, j) = (i * 31 + j * 17 + seed * 7) % 11 - 5;
+    }
+    matrix(i, i) += 20;
+  }
+  return matrix;
+}
+
+static std::vector<S21Matrix> MakeMatrixList(int size, int seed) {
+  std::vector<S21Matrix> matrices;
+  for (int b = 0; b < kBatchCount; b++) {
+    matrices.push_back(MakeBatchOperand(size, seed + b));
+  }
+  return matrices;
+}
+
+static S21MatrixBatch MakeMatrixBatch(int size, int seed) {
+  S21MatrixBatch batch(kBatchCount, size, size);
+  for (int b = 0; b < kBatchCount; b++) {
+    batch.SetMatrix(b, MakeBatchOperand(size, seed + b));
+  }
+  return batch;
+}
+
+static void BM_LoopMul(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  std::vector<S21Matrix> left = MakeMatrixList(size, 0);
+  std::vector<S21Matrix> right = MakeMatrixList(size, 1);
+  for (auto _ : state) {
+    for (int b = 0; b < kBatchCount; b++) {
+      S21Matrix product = left[b] * right[b];
+      benchmark::DoNotOptimize(product);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_LoopMul)->Arg(4)->Arg(8);
+
+static void BM_BatchMul(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21MatrixBatch left = MakeMatrixBatch(size, 0);
+  S21MatrixBatch right = MakeMatrixBatch(size, 1);
+  for (auto _ : state) {
+    S21MatrixBatch product = left.BatchMul(right);
+    benchmark::DoNotOptimize(product);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_BatchMul)->Arg(4)->Arg(8);
+
+static void BM_LoopInverse(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  std::vector<S21Matrix> matrices = MakeMatrixList(size, 0);
+  for (auto _ : state) {
+    for (const S21Matrix& matrix : matrices) {
+      S21Matrix inverse = matrix.InverseMatrix();
+      benchmark::DoNotOptimize(inverse);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_LoopInverse)->Arg(4)->Arg(8);
+
+static void BM_BatchInverse(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21MatrixBatch batch = MakeMatrixBatch(size, 0);
+  for (auto _ : state) {
+    S21MatrixBatch inverse = batch.BatchInverse();
+    benchmark::DoNotOptimize(inverse);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_BatchInverse)->Arg(4)->Arg(8);
+
+static void BM_LoopDeterminant(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  std::vector<S21Matrix> matrices = MakeMatrixList(size, 0);
+  for (auto _ : state) {
+    for (const S21Matrix& matrix : matrices) {
+      benchmark::DoNotOptimize(matrix.Determinant());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_LoopDeterminant)->Arg(4)->Arg(8);
+
+static void BM_BatchDeterminant(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21MatrixBatch batch = MakeMatrixBatch(size, 0);
+  for (auto _ : state) {
+    std::vector<double> determinants = batch.BatchDeterminant();
+    benchmark::DoNotOptimize(determinants);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchCount);
+}
+BENCHMARK(BM_BatchDeterminant)->Arg(4)->Arg(8);
+
+static const char kBenchMatrixFile[] = "bench_s21_matrix.bin";
+
+static void BM_SaveMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (auto _ : state) matrix.Save(kBenchMatrixFile);
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+  std::remove(kBenchMatrixFile);
+}
+BENCHMARK(BM_SaveMatrix)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_LoadMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  matrix.Save(kBenchMatrixFile);
+  for (auto _ : state) {
+    S21Matrix loaded = S21Matrix::Load(kBenchMatrixFile);
+    benchmark::DoNotOptimize(loaded);
+  }
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(double));
+  std::remove(kBenchMatrixFile);
+}
+BENCHMARK(BM_LoadMatrix)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_MapMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  matrix.Save(kBenchMatrixFile);
+  for (auto _ : state) {
+    S21MappedMatrix mapped(kBenchMatrixFile);
+    benchmark::DoNotOptimize(mapped.Data());
+  }
+  std::remove(kBenchMatrixFile);
+}
+BENCHMARK(BM_MapMatrix)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_OutOfCoreMultiply(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  matrix.Save(kBenchMatrixFile);
+  S21FileMatrix file(kBenchMatrixFile);
+  S21OutOfCore engine(static_cast<std::size_t>(state.range(1)) << 20);
+  for (auto _ : state) {
+    engine.Multiply(file, file, "bench_s21_product.bin");
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["read"] = benchmark::Counter(
+      static_cast<double>(engine.GetStats().bytes_read),
+      benchmark::Counter::kAvgIterations);
+  std::remove(kBenchMatrixFile);
+  std::remove("bench_s21_product.bin");
+}
+BENCHMARK(BM_OutOfCoreMultiply)->ArgsProduct({{1024}, {1, 4, 16, 64}});
+
+static void BM_OutOfCoreAdd(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  matrix.Save(kBenchMatrixFile);
+  S21FileMatrix file(kBenchMatrixFile);
+  S21OutOfCore engine(static_cast<std::size_t>(state.range(1)) << 20);
+  for (auto _ : state) engine.Add(file, file, "bench_s21_sum.bin");
+  state.SetBytesProcessed(state.iterations() * 3 * size * size *
+                          sizeof(double));
+  std::remove(kBenchMatrixFile);
+  std::remove("bench_s21_sum.bin");
+}
+BENCHMARK(BM_OutOfCoreAdd)->ArgsProduct({{2048}, {1, 16}});
+
+static void BM_EagerChain(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size), third(size, size);
+  S21Matrix result(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  FillMatrix(third);
+  for (auto _ : state) {
+    S21Matrix sum(first);
+    sum.SumMatrix(second);
+    S21Matrix scaled(third);
+    scaled.MulNumber(2.0);
+    sum.SubMatrix(scaled);
+    result = std::move(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 4 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_EagerChain)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_ExpressionChain(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size), third(size, size);
+  S21Matrix result(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  FillMatrix(third);
+  for (auto _ : state) {
+    result = first.Lazy() + second - third.Lazy() * 2.0;
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 4 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_ExpressionChain)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_TemporaryChain(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size), third(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  FillMatrix(third);
+  long allocations = matrix_allocations;
+  for (auto _ : state) {
+    S21Matrix result = first.Transpose() * 2.0 - third;
+    S21Matrix product = first * second + third - result;
+    benchmark::DoNotOptimize(product);
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(static_cast<double>(matrix_allocations - allocations),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TemporaryChain)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_Transpose(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (auto _ : state) {
+    S21Matrix result = matrix.Transpose();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_Transpose)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_TransposeInPlace(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (auto _ : state) {
+    matrix.TransposeInPlace();
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * size * size *
+                          sizeof(double));
+}
+BENCHMARK(BM_TransposeInPlace)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_MulMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  for (auto _ : state) {
+    S21Matrix result = first * second;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MulMatrix)->RangeMultiplier(2)->Range(16, 1024);
+
+// FLOPS are those of the classic product, so the rate compares directly
+// with BM_MulMatrix.
+static void BM_StrassenMultiply(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  int cutoff = static_cast<int>(state.range(1));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  for (auto _ : state) {
+    S21Matrix result = S21StrassenMultiply(first, second, cutoff);
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_StrassenMultiply)
+    ->ArgsProduct({{512, 1024, 2048}, {128, 256, 512}});
+
+static void BM_TransposedProductCopy(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  long allocations = matrix_allocations;
+  for (auto _ : state) {
+    S21Matrix result = first.Transpose() * second;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(static_cast<double>(matrix_allocations - allocations),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TransposedProductCopy)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_TransposedProductView(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  long allocations = matrix_allocations;
+  for (auto _ : state) {
+    S21Matrix result = first.T() * second;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(static_cast<double>(matrix_allocations - allocations),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TransposedProductView)->RangeMultiplier(4)->Range(16, 1024);
+
+// range(0) is the size of the square operand, range(1) its density in units
+// of 0.1%. The other operand is a dense size x 64 block.
+static S21Matrix MakeSparseOperand(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  long period = 1000 / state.range(1);
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      if ((static_cast<long>(i) * 7919 + j * 104729) % period == 0) {
+        matrix(i, j) = (i * 31 + j * 17) % 101 - 50;
+      }
+    }
+  }
+  return matrix;
+}
+
+static void BM_DenseTimesBlock(benchmark::State& state) {
+  S21Matrix matrix = MakeSparseOperand(state);
+  S21Matrix block(matrix.GetCols(), 64);
+  FillMatrix(block);
+  for (auto _ : state) {
+    S21Matrix result = matrix * block;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["bytes"] = static_cast<double>(
+      sizeof(double) * matrix.GetRows() * matrix.GetCols());
+}
+BENCHMARK(BM_DenseTimesBlock)
+    ->ArgsProduct({{2048, 4096}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SparseTimesBlock(benchmark::State& state) {
+  S21SparseMatrix matrix(MakeSparseOperand(state));
+  S21Matrix block(matrix.GetCols(), 64);
+  FillMatrix(block);
+  for (auto _ : state) {
+    S21Matrix result = matrix * block;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["bytes"] = static_cast<double>(
+      matrix.GetNonZeros() * (sizeof(double) + sizeof(int)) +
+      (matrix.GetRows() + 1) * sizeof(int));
+}
+BENCHMARK(BM_SparseTimesBlock)
+    ->ArgsProduct({{2048, 4096}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SparseTimesVector(benchmark::State& state) {
+  S21SparseMatrix matrix(MakeSparseOperand(state));
+  std::vector<double> vector(matrix.GetCols(), 1.0);
+  for (auto _ : state) {
+    std::vector<double> result = matrix * vector;
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_SparseTimesVector)
+    ->ArgsProduct({{2048, 4096}, {1, 10}})
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_Determinant(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matrix.Determinant());
+  }
+  state.counters["FLOPS"] =
+      benchmark::Counter(2.0 / 3.0 * size * size * size,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_Determinant)
+    ->Arg(8)
+    ->Arg(11)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(2000)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_InverseMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  for (auto _ : state) {
+    S21Matrix result = matrix.InverseMatrix();
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_InverseMatrix)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(500)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_CalcComplements(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size);
+  FillMatrix(matrix);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  for (auto _ : state) {
+    S21Matrix result = matrix.CalcComplements();
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_CalcComplements)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(500)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_SolveViaInverse(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size), rhs(size, static_cast<int>(state.range(1)));
+  FillMatrix(matrix);
+  FillMatrix(rhs);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  for (auto _ : state) {
+    S21Matrix result = matrix.InverseMatrix() * rhs;
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_SolveViaInverse)
+    ->ArgsProduct({{500}, {1, 1000}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_LuSolveCached(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size), rhs(size, static_cast<int>(state.range(1)));
+  FillMatrix(matrix);
+  FillMatrix(rhs);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  S21LuDecomposition lu(matrix);
+  for (auto _ : state) {
+    S21Matrix result = lu.Solve(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LuSolveCached)
+    ->ArgsProduct({{500}, {1, 1000}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_CholeskySolveCached(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size), rhs(size, static_cast<int>(state.range(1)));
+  FillMatrix(matrix);
+  FillMatrix(rhs);
+  matrix = matrix * matrix.Transpose();
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  S21CholeskyDecomposition cholesky(matrix);
+  for (auto _ : state) {
+    S21Matrix result = cholesky.Solve(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CholeskySolveCached)
+    ->ArgsProduct({{500}, {1, 1000}})
+    ->Unit(benchmark::kMillisecond);
+
+template <typename T>
+static void BM_BasicMulMatrix(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix source(size, size);
+  FillMatrix(source);
+  S21BasicMatrix<T> first{S21BasicMatrix<double>(source)};
+  S21BasicMatrix<T> second(first);
+  for (auto _ : state) {
+    S21BasicMatrix<T> result = first * second;
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK_TEMPLATE(BM_BasicMulMatrix, float)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_BasicMulMatrix, double)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_BasicMulMatrix, std::complex<double>)->Arg(256);
+
+static void BM_LuSolve(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size), rhs(size, 1);
+  FillMatrix(matrix);
+  FillMatrix(rhs);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  for (auto _ : state) {
+    S21Matrix result = matrix.Solve(rhs);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LuSolve)->Arg(500)->Arg(2000)->Unit(benchmark::kMillisecond);
+
+static void BM_MixedPrecisionSolve(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21Matrix matrix(size, size), rhs(size, 1);
+  FillMatrix(matrix);
+  FillMatrix(rhs);
+  for (int i = 0; i < size; i++) matrix(i, i) += size;
+  int iterations = 0;
+  for (auto _ : state) {
+    S21MixedPrecisionSolver solver(matrix);
+    S21Matrix result = solver.Solve(rhs);
+    iterations = solver.GetIterations();
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["refinements"] = iterations;
+}
+BENCHMARK(BM_MixedPrecisionSolve)
+    ->Arg(500)
+    ->Arg(2000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_MulMatrixThreads(benchmark::State& state) {
+  int size = static_cast<int>(state.range(0));
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int thread_count = pool.GetThreadCount();
+  pool.SetThreadCount(static_cast<int>(state.range(1)));
+  S21Matrix first(size, size), second(size, size);
+  FillMatrix(first);
+  FillMatrix(second);
+  for (auto _ : state) {
+    S21Matrix result = first * second;
+    benchmark::DoNotOptimize(result);
+  }
+  pool.SetThreadCount(thread_count);
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MulMatrixThreads)
+    ->ArgsProduct({{2048}, {1, 2, 4, 8, 16, 32, 64}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON reports and flags regressions.
+
+Usage: compare_bench.py BASELINE CURRENT [--threshold 0.10]
+                        [--metric cpu_time|real_time]
+
+A benchmark regresses when its time grows by more than the threshold
+relative to the baseline. When the reports hold repetitions, their median
+aggregates are compared. The exit status is 1 if anything regressed.
+"""
+
+import argparse
+import json
+import sys
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    with open(path) as report:
+        benchmarks = json.load(report)["benchmarks"]
+    has_medians = any(b.get("aggregate_name") == "median" for b in benchmarks)
+    times = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred"):
+            continue
+        if has_medians:
+            if benchmark.get("aggregate_name") != "median":
+                continue
+            name = benchmark["run_name"]
+        elif benchmark.get("run_type") == "aggregate":
+            continue
+        else:
+            name = benchmark["name"]
+        scale = NANOSECONDS[benchmark.get("time_unit", "ns")]
+        times[name] = benchmark[metric] * scale
+    return times
+
+
+def format_time(nanoseconds):
+    for unit in ("s", "ms", "us"):
+        if nanoseconds >= NANOSECONDS[unit]:
+            return "%.3g %s" % (nanoseconds / NANOSECONDS[unit], unit)
+    return "%.3g ns" % nanoseconds
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10)
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"),
+                        default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    current = load_times(args.current, args.metric)
+    regressions = 0
+    width = max((len(name) for name in current), default=0)
+    for name, time in current.items():
+        if name not in baseline:
+            print("%-*s  %12s  %12s  new" %
+                  (width, name, "", format_time(time)))
+            continue
+        change = time / baseline[name] - 1.0
+        verdict = ""
+        if change > args.threshold:
+            verdict = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            verdict = "improved"
+        line = "%-*s  %12s  %12s  %+7.1f%%  %s" % (
+            width, name, format_time(baseline[name]), format_time(time),
+            100.0 * change, verdict)
+        print(line.rstrip())
+    for name in baseline:
+        if name not in current:
+            print("%-*s  missing from the current report" % (width, name))
+
+    print("%d of %d benchmarks regressed by more than %.0f%%" %
+          (regressions, len(current), 100.0 * args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,560 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_BASIC_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_BASIC_MATRIX_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_matrix_oop.h"
+
+template <typename T>
+struct S21IsMatrixElement
+    : std::bool_constant<std::is_same_v<T, float> ||
+                         std::is_same_v<T, double>> {};
+
+template <typename T>
+struct S21IsMatrixElement<std::complex<T>> : S21IsMatrixElement<T> {};
+
+// C += alpha * A * B for row-major operands: S21Gemm for float and double,
+// a plain loop nest for complex elements.
+template <typename T>
+void S21BasicGemm(int m, int n, int k, const T* a, std::ptrdiff_t lda,
+                  const T* b, std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc,
+                  T alpha = T(1)) {
+  if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+    S21Gemm(m, n, k, a, lda, 1, b, ldb, 1, c, ldc, alpha);
+  } else {
+    for (int i = 0; i < m; i++) {
+      T* c_row = c + i * ldc;
+      for (int p = 0; p < k; p++) {
+        T factor = alpha * a[i * lda + p];
+        const T* b_row = b + p * ldb;
+        for (int j = 0; j < n; j++) c_row[j] += factor * b_row[j];
+      }
+    }
+  }
+}
+
+template <typename T>
+using S21RealOf = decltype(std::abs(std::declval<T>()));
+
+constexpr int kS21LuBlockSize = 64;
+constexpr int kS21LuPanelSize = 8;
+
+// Blocked LU factorization with partial pivoting of the size x size matrix at
+// lu (row stride ld), in place, so that most of the work is done by
+// S21BasicGemm. Row k was swapped with row pivots[k]; returns the sign of the
+// permutation. S21LuDecomposition and S21BasicLuDecomposition share it.
+template <typename T>
+int S21BasicLuFactorize(int size, T* lu, std::ptrdiff_t ld, int* pivots) {
+  auto row_data = [lu, ld](int row) { return lu + row * ld; };
+  int sign = 1;
+  for (int block = 0; block < size; block += kS21LuBlockSize) {
+    int block_end = std::min(block + kS21LuBlockSize, size);
+
+    for (int k = block; k < block_end; k++) {
+      int pivot = k;
+      for (int i = k + 1; i < size; i++) {
+        if (std::abs(row_data(i)[k]) > std::abs(row_data(pivot)[k]))
+          pivot = i;
+      }
+      pivots[k] = pivot;
+      if (pivot != k) {
+        std::swap_ranges(row_data(k), row_data(k) + size, row_data(pivot));
+        sign = -sign;
+      }
+
+      const T* pivot_row = row_data(k);
+      if (pivot_row[k] == T(0)) continue;
+      for (int i = k + 1; i < size; i++) {
+        T* row = row_data(i);
+        T factor = row[k] /= pivot_row[k];
+        if (factor == T(0)) continue;
+        for (int j = k + 1; j < block_end; j++) {
+          row[j] -= factor * pivot_row[j];
+        }
+      }
+    }
+
+    if (block_end < size) {
+      // U12 = L11^-1 * A12, kS21LuPanelSize rows at a time so that only the
+      // triangles on the diagonal of L11 are left to the scalar loop.
+      for (int panel = block; panel < block_end; panel += kS21LuPanelSize) {
+        int panel_end = std::min(panel + kS21LuPanelSize, block_end);
+        S21BasicGemm(panel_end - panel, size - block_end, panel - block,
+                     row_data(panel) + block, ld, row_data(block) + block_end,
+                     ld, row_data(panel) + block_end, ld, T(-1));
+        for (int i = panel + 1; i < panel_end; i++) {
+          T* row = row_data(i);
+          for (int p = panel; p < i; p++) {
+            T factor = row[p];
+            const T* upper_row = row_data(p);
+            for (int j = block_end; j < size; j++) {
+              row[j] -= factor * upper_row[j];
+            }
+          }
+        }
+      }
+      S21BasicGemm(size - block_end, size - block_end, block_end - block,
+                   row_data(block_end) + block, ld,
+                   row_data(block) + block_end, ld,
+                   row_data(block_end) + block_end, ld, T(-1));
+    }
+  }
+  return sign;
+}
+
+// Overwrites the size x rhs_cols matrix at rhs with the solution of
+// A * X = rhs, given the factorization of A by S21BasicLuFactorize.
+template <typename T>
+void S21BasicLuSolve(int size, const T* lu, std::ptrdiff_t ld,
+                     const int* pivots, int rhs_cols, T* rhs,
+                     std::ptrdiff_t rhs_ld) {
+  auto lu_row = [lu, ld](int row) { return lu + row * ld; };
+  auto rhs_row = [rhs, rhs_ld](int row) { return rhs + row * rhs_ld; };
+  for (int k = 0; k < size; k++) {
+    if (pivots[k] != k) {
+      std::swap_ranges(rhs_row(k), rhs_row(k) + rhs_cols, rhs_row(pivots[k]));
+    }
+  }
+
+  for (int block = 0; block < size; block += kS21LuBlockSize) {
+    int block_end = std::min(block + kS21LuBlockSize, size);
+    S21BasicGemm(block_end - block, rhs_cols, block, lu_row(block), ld, rhs,
+                 rhs_ld, rhs_row(block), rhs_ld, T(-1));
+    for (int i = block + 1; i < block_end; i++) {
+      T* row = rhs_row(i);
+      for (int p = block; p < i; p++) {
+        T factor = lu_row(i)[p];
+        const T* solved_row = rhs_row(p);
+        for (int j = 0; j < rhs_cols; j++) row[j] -= factor * solved_row[j];
+      }
+    }
+  }
+
+  for (int block_end = size; block_end > 0; block_end -= kS21LuBlockSize) {
+    int block = std::max(block_end - kS21LuBlockSize, 0);
+    S21BasicGemm(block_end - block, rhs_cols, size - block_end,
+                 lu_row(block) + block_end, ld, rhs_row(block_end), rhs_ld,
+                 rhs_row(block), rhs_ld, T(-1));
+    for (int i = block_end - 1; i >= block; i--) {
+      T* row = rhs_row(i);
+      for (int p = i + 1; p < block_end; p++) {
+        T factor = lu_row(i)[p];
+        const T* solved_row = rhs_row(p);
+        for (int j = 0; j < rhs_cols; j++) row[j] -= factor * solved_row[j];
+      }
+      T diagonal = lu_row(i)[i];
+      for (int j = 0; j < rhs_cols; j++) row[j] /= diagonal;
+    }
+  }
+}
+
+// The cofactors of a numerically singular size x size matrix in O(n^3),
+// written to result. lu holds a copy of the matrix and is overwritten by an
+// elimination with complete pivoting. Below rank size - 1 every cofactor is
+// zero; at rank size - 1 the cofactor matrix is a multiple of the outer
+// product of the left and right null vectors.
+template <typename T>
+void S21BasicSingularComplements(int size, T* lu, std::ptrdiff_t ld,
+                                 S21RealOf<T> tolerance, T* result,
+                                 std::ptrdiff_t result_ld) {
+  auto row_data = [lu, ld](int row) { return lu + row * ld; };
+  std::vector<int> row_order(size), col_order(size);
+  for (int i = 0; i < size; i++) row_order[i] = col_order[i] = i;
+  int sign = 1;
+  int rank = 0;
+
+  // Only reached when the matrix is numerically singular, so the last pivot
+  // is treated as zero and at most size - 1 pivots are eliminated.
+  for (int k = 0; k < size - 1; k++) {
+    int pivot_row = k, pivot_col = k;
+    for (int i = k; i < size; i++) {
+      const T* row = row_data(i);
+      for (int j = k; j < size; j++) {
+        if (std::abs(row[j]) > std::abs(row_data(pivot_row)[pivot_col])) {
+          pivot_row = i;
+          pivot_col = j;
+        }
+      }
+    }
+    if (std::abs(row_data(pivot_row)[pivot_col]) <= tolerance) break;
+    rank++;
+
+    if (pivot_row != k) {
+      std::swap_ranges(row_data(k), row_data(k) + size, row_data(pivot_row));
+      std::swap(row_order[k], row_order[pivot_row]);
+      sign = -sign;
+    }
+    if (pivot_col != k) {
+      for (int i = 0; i < size; i++) {
+        std::swap(row_data(i)[k], row_data(i)[pivot_col]);
+      }
+      std::swap(col_order[k], col_order[pivot_col]);
+      sign = -sign;
+    }
+
+    const T* pivot_values = row_data(k);
+    for (int i = k + 1; i < size; i++) {
+      T* row = row_data(i);
+      T factor = row[k] /= pivot_values[k];
+      for (int j = k + 1; j < size; j++) row[j] -= factor * pivot_values[j];
+    }
+  }
+
+  for (int i = 0; i < size; i++) {
+    std::fill(result + i * result_ld, result + i * result_ld + size, T(0));
+  }
+  if (rank < size - 1) return;
+
+  int last = size - 1;
+  std::vector<T> right_null(size), left_null(size);
+  right_null[last] = 1;
+  for (int i = last - 1; i >= 0; i--) {
+    const T* row = row_data(i);
+    T sum = row[last];
+    for (int p = i + 1; p < last; p++) sum += row[p] * right_null[p];
+    right_null[i] = -sum / row[i];
+  }
+  left_null[last] = 1;
+  for (int i = last - 1; i >= 0; i--) {
+    T sum = 0;
+    for (int p = i + 1; p < size; p++) sum += row_data(p)[i] * left_null[p];
+    left_null[i] = -sum;
+  }
+
+  T scale = static_cast<S21RealOf<T>>(sign);
+  for (int i = 0; i < last; i++) scale *= row_data(i)[i];
+  std::vector<T> x(size), y(size);
+  for (int i = 0; i < size; i++) {
+    x[col_order[i]] = right_null[i];
+    y[row_order[i]] = left_null[i];
+  }
+  for (int i = 0; i < size; i++) {
+    T* row = result + i * result_ld;
+    for (int j = 0; j < size; j++) row[j] = scale * y[i] * x[j];
+  }
+}
+
+template <typename T>
+class S21BasicLuDecomposition;
+
+// A matrix of float, double, std::complex<float> or std::complex<double>
+// elements with the interface of S21Matrix. S21Matrix itself stays the double
+// matrix that views, expressions, arenas and the file formats are built on;
+// conversions to and from it are explicit. A float matrix halves the memory
+// traffic of a double one, and its products and factorizations run through
+// the float S21Gemm.
+template <typename T>
+class S21BasicMatrix {
+  static_assert(S21IsMatrixElement<T>::value,
+                "Matrix elements must be float, double or std::complex");
+
+ public:
+  using Real = S21RealOf<T>;
+  // float keeps about seven significant digits, too few for
+  // S21_MATRIX_OOP_EPS.
+  static constexpr Real kEps =
+      std::is_same_v<Real, float> ? Real(1e-4) : Real(S21_MATRIX_OOP_EPS);
+
+  S21BasicMatrix() : S21BasicMatrix(3, 3) {}
+  S21BasicMatrix(int rows, int cols) : rows_(rows), cols_(cols) {
+    CheckRowsAndColsArePositive();
+    data_.resize(static_cast<std::size_t>(rows_) * cols_);
+  }
+  template <typename U>
+  explicit S21BasicMatrix(const S21BasicMatrix<U>& other)
+      : rows_(other.rows_), cols_(other.cols_), data_(other.data_.size()) {
+    std::transform(other.data_.begin(), other.data_.end(), data_.begin(),
+                   [](const U& value) { return static_cast<T>(value); });
+  }
+  explicit S21BasicMatrix(const S21ConstMatrixView& matrix)
+      : S21BasicMatrix(matrix.GetRows(), matrix.GetCols()) {
+    for (int i = 0; i < rows_; i++) {
+      const double* row = matrix.Data() + i * matrix.GetRowStride();
+      for (int j = 0; j < cols_; j++) {
+        RowData(i)[j] = static_cast<T>(row[j * matrix.GetColStride()]);
+      }
+    }
+  }
+
+  // Only for real elements.
+  explicit operator S21Matrix() const {
+    S21Matrix matrix(rows_, cols_);
+    S21MatrixView view(matrix);
+    for (int i = 0; i < rows_; i++) {
+      double* row = view.Data() + i * view.GetRowStride();
+      for (int j = 0; j < cols_; j++) row[j] = RowData(i)[j];
+    }
+    return matrix;
+  }
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  void SetRows(int rows) {
+    if (rows <= 0)
+      throw std::logic_error("The number of rows must be positive");
+    data_.resize(static_cast<std::size_t>(rows) * cols_);
+    rows_ = rows;
+  }
+  void SetCols(int cols) {
+    if (cols <= 0)
+      throw std::logic_error("The number of columns must be positive");
+    S21BasicMatrix resized(rows_, cols);
+    int kept = std::min(cols_, cols);
+    for (int i = 0; i < rows_; i++) {
+      std::copy(RowData(i), RowData(i) + kept, resized.RowData(i));
+    }
+    *this = std::move(resized);
+  }
+  // Row-major elements, GetCols() apart between rows.
+  T* Data() noexcept { return data_.data(); }
+  const T* Data() const noexcept { return data_.data(); }
+
+  T& operator()(int row, int col) {
+    CheckIndexesAreInRange(row, col);
+    return RowData(row)[col];
+  }
+  const T& operator()(int row, int col) const {
+    CheckIndexesAreInRange(row, col);
+    return RowData(row)[col];
+  }
+
+  bool EqMatrix(const S21BasicMatrix& other) const {
+    if (other.rows_ != rows_ || other.cols_ != cols_) return false;
+    for (std::size_t i = 0; i < data_.size(); i++) {
+      if (std::abs(data_[i] - other.data_[i]) > kEps)
+        return false;
+    }
+    return true;
+  }
+  void SumMatrix(const S21BasicMatrix& other) {
+    CheckHasSameDimensions(other);
+    for (std::size_t i = 0; i < data_.size(); i++) data_[i] += other.data_[i];
+  }
+  void SubMatrix(const S21BasicMatrix& other) {
+    CheckHasSameDimensions(other);
+    for (std::size_t i = 0; i < data_.size(); i++) data_[i] -= other.data_[i];
+  }
+  void MulNumber(T num) {
+    for (T& value : data_) value *= num;
+  }
+  void MulMatrix(const S21BasicMatrix& other) { *this = *this * other; }
+  S21BasicMatrix Transpose() const {
+    S21BasicMatrix result(cols_, rows_);
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) result.RowData(j)[i] = RowData(i)[j];
+    }
+    return result;
+  }
+  S21BasicMatrix CalcComplements() const;
+  T Determinant() const;
+  S21BasicMatrix InverseMatrix() const;
+  S21BasicMatrix Solve(const S21BasicMatrix& rhs) const;
+
+  S21BasicMatrix operator*(const S21BasicMatrix& other) const {
+    if (cols_ != other.rows_)
+      throw std::logic_error(
+          "The number of columns of the first matrix is not equal to the "
+          "number of rows of the second matrix");
+    S21BasicMatrix result(rows_, other.cols_);
+    S21BasicGemm(rows_, other.cols_, cols_, Data(), cols_, other.Data(),
+                 other.cols_, result.Data(), result.cols_);
+    return result;
+  }
+  bool operator==(const S21BasicMatrix& other) const {
+    return EqMatrix(other);
+  }
+  S21BasicMatrix& operator+=(const S21BasicMatrix& other) {
+    SumMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix& operator-=(const S21BasicMatrix& other) {
+    SubMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix& operator*=(const S21BasicMatrix& other) {
+    MulMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix& operator*=(T num) {
+    MulNumber(num);
+    return *this;
+  }
+
+ private:
+  template <typename>
+  friend class S21BasicMatrix;
+  friend class S21BasicLuDecomposition<T>;
+
+  void CheckRowsAndColsArePositive() const {
+    if (rows_ <= 0 || cols_ <= 0)
+      throw std::logic_error(
+          "Numbers of rows and columns in a matrix must be positive");
+  }
+  void CheckIndexesAreInRange(int row, int col) const {
+    if (row >= rows_ || row < 0 || col >= cols_ || col < 0)
+      throw std::out_of_range("Index is outside the matrix");
+  }
+  void CheckIsSquare() const {
+    if (rows_ != cols_) throw std::logic_error("The matrix is not square");
+  }
+  void CheckHasSameDimensions(const S21BasicMatrix& other) const {
+    if (rows_ != other.rows_ || cols_ != other.cols_)
+      throw std::logic_error("Matrices must have the same dimensions");
+  }
+  T* RowData(int row) noexcept {
+    return data_.data() + static_cast<std::size_t>(row) * cols_;
+  }
+  const T* RowData(int row) const noexcept {
+    return data_.data() + static_cast<std::size_t>(row) * cols_;
+  }
+  Real MaxAbsValue() const noexcept {
+    Real result = 0;
+    for (const T& value : data_) result = std::max(result, std::abs(value));
+    return result;
+  }
+
+  int rows_, cols_;
+  std::vector<T> data_;
+};
+
+// LU factorization with partial pivoting by S21BasicLuFactorize.
+template <typename T>
+class S21BasicLuDecomposition {
+ public:
+  using Real = typename S21BasicMatrix<T>::Real;
+
+  explicit S21BasicLuDecomposition(const S21BasicMatrix<T>& matrix)
+      : lu_(matrix), pivots_(matrix.rows_), scale_(matrix.MaxAbsValue()) {
+    lu_.CheckIsSquare();
+    sign_ = S21BasicLuFactorize(lu_.rows_, lu_.Data(), lu_.cols_,
+                                pivots_.data());
+  }
+
+  S21BasicMatrix<T> Solve(const S21BasicMatrix<T>& rhs) const {
+    S21BasicMatrix<T> result(rhs);
+    SolveInPlace(result);
+    return result;
+  }
+  void SolveInPlace(S21BasicMatrix<T>& rhs) const;
+  S21BasicMatrix<T> Inverse() const {
+    S21BasicMatrix<T> result(lu_.rows_, lu_.rows_);
+    for (int i = 0; i < lu_.rows_; i++) result.RowData(i)[i] = 1;
+    SolveInPlace(result);
+    return result;
+  }
+  T Determinant() const noexcept {
+    T result = static_cast<Real>(sign_);
+    for (int i = 0; i < lu_.rows_; i++) result *= lu_.RowData(i)[i];
+    return result;
+  }
+  bool IsSingular() const noexcept {
+    Real tolerance = lu_.rows_ * std::numeric_limits<Real>::epsilon() * scale_;
+    for (int i = 0; i < lu_.rows_; i++) {
+      if (!(std::abs(lu_.RowData(i)[i]) > tolerance)) return true;
+    }
+    return false;
+  }
+  int GetSize() const noexcept { return lu_.rows_; }
+
+ private:
+  S21BasicMatrix<T> lu_;
+  std::vector<int> pivots_;
+  int sign_;
+  Real scale_;
+};
+
+using S21FloatMatrix = S21BasicMatrix<float>;
+using S21ComplexMatrix = S21BasicMatrix<std::complex<double>>;
+
+template <typename T>
+S21BasicMatrix<T> operator+(S21BasicMatrix<T> left,
+                            const S21BasicMatrix<T>& right) {
+  left.SumMatrix(right);
+  return left;
+}
+
+template <typename T>
+S21BasicMatrix<T> operator-(S21BasicMatrix<T> left,
+                            const S21BasicMatrix<T>& right) {
+  left.SubMatrix(right);
+  return left;
+}
+
+template <typename T>
+S21BasicMatrix<T> operator*(S21BasicMatrix<T> matrix,
+                            typename S21BasicMatrix<T>::Real num) {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <typename T>
+S21BasicMatrix<T> operator*(typename S21BasicMatrix<T>::Real num,
+                            S21BasicMatrix<T> matrix) {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <typename T>
+T S21BasicMatrix<T>::Determinant() const {
+  CheckIsSquare();
+  return S21BasicLuDecomposition<T>(*this).Determinant();
+}
+
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::InverseMatrix() const {
+  CheckIsSquare();
+  return S21BasicLuDecomposition<T>(*this).Inverse();
+}
+
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::Solve(const S21BasicMatrix& rhs) const {
+  CheckIsSquare();
+  return S21BasicLuDecomposition<T>(*this).Solve(rhs);
+}
+
+// Cofactors are det(A) * inverse(A)^T for invertible matrices; singular ones
+// go through S21BasicSingularComplements, like S21Matrix::CalcComplements.
+template <typename T>
+S21BasicMatrix<T> S21BasicMatrix<T>::CalcComplements() const {
+  CheckIsSquare();
+  int size = rows_;
+  S21BasicMatrix result(size, size);
+  if (size == 1) {
+    result.data_[0] = 1;
+    return result;
+  }
+
+  S21BasicLuDecomposition<T> lu(*this);
+  if (!lu.IsSingular()) {
+    result = lu.Inverse().Transpose();
+    result.MulNumber(lu.Determinant());
+    return result;
+  }
+  S21BasicMatrix scratch(*this);
+  Real tolerance = size * std::numeric_limits<Real>::epsilon() * MaxAbsValue();
+  S21BasicSingularComplements(size, scratch.Data(), size, tolerance,
+                              result.Data(), size);
+  return result;
+}
+
+template <typename T>
+void S21BasicLuDecomposition<T>::SolveInPlace(S21BasicMatrix<T>& rhs) const {
+  if (rhs.rows_ != lu_.rows_)
+    throw std::logic_error(
+        "The number of rows of the right-hand side is not equal to the size "
+        "of the matrix");
+  if (IsSingular()) throw std::logic_error("The matrix is not invertible");
+  S21BasicLuSolve(lu_.rows_, lu_.Data(), lu_.cols_, pivots_.data(), rhs.cols_,
+                  rhs.Data(), rhs.cols_);
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_BASIC_MATRIX_H_
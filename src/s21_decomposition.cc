@@ -0,0 +1,318 @@
+#include "s21_decomposition.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "s21_gemm.h"
+
+namespace {
+
+void CheckRhsRows(int size, const S21Matrix& rhs) {
+  if (rhs.GetRows() != size)
+    throw std::logic_error(
+        "The number of rows of the right-hand side is not equal to the size "
+        "of the matrix");
+}
+
+template <typename Decomposition>
+std::vector<S21Matrix> SolveBatched(const Decomposition& decomposition,
+                                    const std::vector<S21Matrix>& rhs) {
+  int size = decomposition.GetSize();
+  int total_cols = 0;
+  for (const S21Matrix& item : rhs) {
+    CheckRhsRows(size, item);
+    total_cols += item.GetCols();
+  }
+  std::vector<S21Matrix> result;
+  if (rhs.empty()) return result;
+
+  S21Matrix batch(size, total_cols);
+  for (int i = 0; i < size; i++) {
+    double* batch_row = &batch(i, 0);
+    for (const S21Matrix& item : rhs) {
+      std::memcpy(batch_row, &item(i, 0), item.GetCols() * sizeof(double));
+      batch_row += item.GetCols();
+    }
+  }
+
+  decomposition.SolveInPlace(batch);
+
+  result.reserve(rhs.size());
+  int offset = 0;
+  for (const S21Matrix& item : rhs) {
+    S21Matrix solution(size, item.GetCols());
+    for (int i = 0; i < size; i++) {
+      std::memcpy(&solution(i, 0), &batch(i, offset),
+                  item.GetCols() * sizeof(double));
+    }
+    offset += item.GetCols();
+    result.push_back(std::move(solution));
+  }
+  return result;
+}
+
+}  // namespace
+
+S21LuDecomposition::S21LuDecomposition(const S21Matrix& matrix)
+    : lu_(matrix), pivots_(matrix.rows_), scale_(matrix.MaxAbsValue()) {
+  lu_.CheckMatrixIsSquare();
+  sign_ = S21BasicLuFactorize(lu_.rows_, lu_.matrix_, lu_.stride_,
+                              pivots_.data());
+}
+
+bool S21LuDecomposition::IsSingular() const noexcept {
+  double tolerance =
+      lu_.rows_ * std::numeric_limits<double>::epsilon() * scale_;
+  for (int i = 0; i < lu_.rows_; i++) {
+    if (fabs(lu_.RowData(i)[i]) <= tolerance) return true;
+  }
+  return false;
+}
+
+void S21LuDecomposition::CheckIsInvertible() const {
+  if (IsSingular()) throw std::logic_error("The matrix is not invertible");
+}
+
+int S21LuDecomposition::GetSize() const noexcept { return lu_.rows_; }
+
+double S21LuDecomposition::Determinant() const noexcept {
+  double result = sign_;
+  for (int i = 0; i < lu_.rows_; i++) {
+    result *= lu_.RowData(i)[i];
+  }
+  return result;
+}
+
+double S21LuDecomposition::LogAbsDeterminant(int& sign) const noexcept {
+  sign = sign_;
+  double result = 0;
+  for (int i = 0; i < lu_.rows_; i++) {
+    double diagonal = lu_.RowData(i)[i];
+    if (diagonal == 0) {
+      sign = 0;
+      return -INFINITY;
+    }
+    if (diagonal < 0) sign = -sign;
+    result += log(fabs(diagonal));
+  }
+  return result;
+}
+
+S21Matrix S21LuDecomposition::Solve(const S21Matrix& rhs) const {
+  S21Matrix result(rhs);
+  SolveInPlace(result);
+  return result;
+}
+
+std::vector<S21Matrix> S21LuDecomposition::SolveMany(
+    const std::vector<S21Matrix>& rhs) const {
+  return SolveBatched(*this, rhs);
+}
+
+S21Matrix S21LuDecomposition::Inverse() const {
+  S21Matrix result(lu_.rows_, lu_.rows_);
+  for (int i = 0; i < lu_.rows_; i++) {
+    result.RowData(i)[i] = 1;
+  }
+  SolveInPlace(result);
+  return result;
+}
+
+void S21LuDecomposition::SolveInPlace(S21Matrix& rhs) const {
+  CheckRhsRows(lu_.rows_, rhs);
+  CheckIsInvertible();
+  S21BasicLuSolve(lu_.rows_, lu_.matrix_, lu_.stride_, pivots_.data(),
+                  rhs.cols_, rhs.matrix_, rhs.stride_);
+}
+
+S21CholeskyDecomposition::S21CholeskyDecomposition(const S21Matrix& matrix)
+    : l_(matrix) {
+  l_.CheckMatrixIsSquare();
+  Factorize();
+}
+
+void S21CholeskyDecomposition::Factorize() {
+  int size = l_.rows_;
+  for (int block = 0; block < size; block += kBlockSize) {
+    int block_end = std::min(block + kBlockSize, size);
+
+    for (int j = block; j < block_end; j++) {
+      double* row_j = l_.RowData(j);
+      double diagonal = row_j[j];
+      for (int p = block; p < j; p++) diagonal -= row_j[p] * row_j[p];
+      if (diagonal <= 0 || std::isnan(diagonal))
+        throw std::logic_error("The matrix is not positive definite");
+      row_j[j] = sqrt(diagonal);
+
+      for (int i = j + 1; i < size; i++) {
+        double* row_i = l_.RowData(i);
+        double value = row_i[j];
+        for (int p = block; p < j; p++) value -= row_i[p] * row_j[p];
+        row_i[j] = value / row_j[j];
+      }
+    }
+
+    if (block_end < size) {
+      const double* panel = l_.RowData(block_end) + block;
+      S21Gemm(size - block_end, size - block_end, block_end - block, panel,
+              l_.stride_, 1, panel, 1, l_.stride_,
+              l_.RowData(block_end) + block_end, l_.stride_, -1.0);
+    }
+  }
+
+  for (int i = 0; i < size; i++) {
+    std::fill(l_.RowData(i) + i + 1, l_.RowData(i) + size, 0.0);
+  }
+}
+
+int S21CholeskyDecomposition::GetSize() const noexcept { return l_.rows_; }
+
+S21Matrix S21CholeskyDecomposition::GetL() const { return l_; }
+
+double S21CholeskyDecomposition::Determinant() const noexcept {
+  double result = 1;
+  for (int i = 0; i < l_.rows_; i++) {
+    result *= l_.RowData(i)[i] * l_.RowData(i)[i];
+  }
+  return result;
+}
+
+S21Matrix S21CholeskyDecomposition::Solve(const S21Matrix& rhs) const {
+  S21Matrix result(rhs);
+  SolveInPlace(result);
+  return result;
+}
+
+std::vector<S21Matrix> S21CholeskyDecomposition::SolveMany(
+    const std::vector<S21Matrix>& rhs) const {
+  return SolveBatched(*this, rhs);
+}
+
+void S21CholeskyDecomposition::SolveInPlace(S21Matrix& rhs) const {
+  int size = l_.rows_;
+  CheckRhsRows(size, rhs);
+  int rhs_cols = rhs.cols_;
+
+  for (int block = 0; block < size; block += kBlockSize) {
+    int block_end = std::min(block + kBlockSize, size);
+    S21Gemm(block_end - block, rhs_cols, block, l_.RowData(block), l_.stride_,
+            1, rhs.matrix_, rhs.stride_, 1, rhs.RowData(block), rhs.stride_,
+            -1.0);
+    for (int i = block; i < block_end; i++) {
+      double* row = rhs.RowData(i);
+      for (int p = block; p < i; p++) {
+        double factor = l_.RowData(i)[p];
+        const double* solved_row = rhs.RowData(p);
+        for (int j = 0; j < rhs_cols; j++) row[j] -= factor * solved_row[j];
+      }
+      double diagonal = l_.RowData(i)[i];
+      for (int j = 0; j < rhs_cols; j++) row[j] /= diagonal;
+    }
+  }
+
+  for (int block_end = size; block_end > 0; block_end -= kBlockSize) {
+    int block = std::max(block_end - kBlockSize, 0);
+    S21Gemm(block_end - block, rhs_cols, size - block_end,
+            l_.RowData(block_end) + block, 1, l_.stride_,
+            rhs.RowData(block_end), rhs.stride_, 1, rhs.RowData(block),
+            rhs.stride_, -1.0);
+    for (int i = block_end - 1; i >= block; i--) {
+      double* row = rhs.RowData(i);
+      for (int p = i + 1; p < block_end; p++) {
+        double factor = l_.RowData(p)[i];
+        const double* solved_row = rhs.RowData(p);
+        for (int j = 0; j < rhs_cols; j++) row[j] -= factor * solved_row[j];
+      }
+      double diagonal = l_.RowData(i)[i];
+      for (int j = 0; j < rhs_cols; j++) row[j] /= diagonal;
+    }
+  }
+}
+
+S21MixedPrecisionSolver::S21MixedPrecisionSolver(const S21Matrix& matrix)
+    : matrix_(matrix), tolerance_(0), iterations_(0) {
+  if (matrix_.GetRows() != matrix_.GetCols())
+    throw std::logic_error("The matrix is not square");
+  int size = matrix_.GetRows();
+  double norm = 0, max_abs = 0;
+  for (int i = 0; i < size; i++) {
+    const double* row = matrix_.RowData(i);
+    double row_sum = 0;
+    for (int j = 0; j < size; j++) {
+      row_sum += fabs(row[j]);
+      max_abs = std::max(max_abs, fabs(row[j]));
+    }
+    norm = std::max(norm, row_sum);
+  }
+  tolerance_ = norm * std::numeric_limits<double>::epsilon() * sqrt(size);
+
+  if (max_abs > std::numeric_limits<float>::max()) {
+    FallBackToDouble();
+    return;
+  }
+  lu_.emplace(S21FloatMatrix(matrix_));
+  if (lu_->IsSingular()) FallBackToDouble();
+}
+
+void S21MixedPrecisionSolver::FallBackToDouble() {
+  lu_.reset();
+  if (!fallback_) fallback_.emplace(matrix_);
+}
+
+S21Matrix S21MixedPrecisionSolver::Residual(const S21Matrix& rhs,
+                                            const S21Matrix& solution) const {
+  S21Matrix residual(rhs);
+  S21ConstMatrixView a(matrix_), x(solution);
+  S21MatrixView r(residual);
+  S21Gemm(r.GetRows(), r.GetCols(), a.GetCols(), a.Data(), a.GetRowStride(),
+          a.GetColStride(), x.Data(), x.GetRowStride(), x.GetColStride(),
+          r.Data(), r.GetRowStride(), -1.0);
+  return residual;
+}
+
+// Column by column: |r|_inf <= |x|_inf * |A|_inf * eps * sqrt(n).
+bool S21MixedPrecisionSolver::HasConverged(
+    const S21Matrix& solution, const S21Matrix& residual) const noexcept {
+  for (int j = 0; j < solution.GetCols(); j++) {
+    double solution_norm = 0, residual_norm = 0;
+    for (int i = 0; i < solution.GetRows(); i++) {
+      solution_norm = std::max(solution_norm, fabs(solution(i, j)));
+      residual_norm = std::max(residual_norm, fabs(residual(i, j)));
+    }
+    if (!(residual_norm <= solution_norm * tolerance_)) return false;
+  }
+  return true;
+}
+
+S21Matrix S21MixedPrecisionSolver::Solve(const S21Matrix& rhs) {
+  CheckRhsRows(GetSize(), rhs);
+  iterations_ = 0;
+  if (lu_) {
+    S21Matrix solution =
+        static_cast<S21Matrix>(lu_->Solve(S21FloatMatrix(rhs)));
+    S21Matrix residual = Residual(rhs, solution);
+    while (iterations_ < kMaxIterations && !HasConverged(solution, residual)) {
+      iterations_++;
+      solution.SumMatrix(
+          static_cast<S21Matrix>(lu_->Solve(S21FloatMatrix(residual))));
+      residual = Residual(rhs, solution);
+    }
+    if (HasConverged(solution, residual)) return solution;
+    FallBackToDouble();
+  }
+  return fallback_->Solve(rhs);
+}
+
+int S21MixedPrecisionSolver::GetIterations() const noexcept {
+  return iterations_;
+}
+
+bool S21MixedPrecisionSolver::UsesDoublePrecision() const noexcept {
+  return fallback_.has_value();
+}
+
+int S21MixedPrecisionSolver::GetSize() const noexcept {
+  return matrix_.GetRows();
+}
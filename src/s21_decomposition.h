@@ -0,0 +1,83 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_DECOMPOSITION_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_DECOMPOSITION_H_
+
+#include <optional>
+#include <vector>
+
+#include "s21_basic_matrix.h"
+#include "s21_matrix_oop.h"
+
+// The double instantiation of S21BasicLuFactorize on an S21Matrix.
+class S21LuDecomposition {
+ public:
+  explicit S21LuDecomposition(const S21Matrix& matrix);
+
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  std::vector<S21Matrix> SolveMany(const std::vector<S21Matrix>& rhs) const;
+  void SolveInPlace(S21Matrix& rhs) const;
+  S21Matrix Inverse() const;
+  double Determinant() const noexcept;
+  double LogAbsDeterminant(int& sign) const noexcept;
+  bool IsSingular() const noexcept;
+  int GetSize() const noexcept;
+
+ private:
+  void CheckIsInvertible() const;
+
+  S21Matrix lu_;
+  std::vector<int> pivots_;
+  int sign_;
+  double scale_;
+};
+
+// Factorizes a symmetric positive definite matrix as L * L^T. Only the lower
+// triangle of the input is read.
+class S21CholeskyDecomposition {
+ public:
+  explicit S21CholeskyDecomposition(const S21Matrix& matrix);
+
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  std::vector<S21Matrix> SolveMany(const std::vector<S21Matrix>& rhs) const;
+  void SolveInPlace(S21Matrix& rhs) const;
+  double Determinant() const noexcept;
+  S21Matrix GetL() const;
+  int GetSize() const noexcept;
+
+ private:
+  static constexpr int kBlockSize = 64;
+
+  void Factorize();
+
+  S21Matrix l_;
+};
+
+// Solves A * X = B to double accuracy from a float LU factorization: each
+// refinement step solves for the correction of the residual computed in
+// double. When that does not converge (roughly cond(A) > 1e7) or A does not
+// fit in float, A is factorized again in double, as LAPACK's dsgesv does.
+class S21MixedPrecisionSolver {
+ public:
+  static constexpr int kMaxIterations = 30;
+
+  explicit S21MixedPrecisionSolver(const S21Matrix& matrix);
+
+  S21Matrix Solve(const S21Matrix& rhs);
+  // Refinement steps taken by the last Solve.
+  int GetIterations() const noexcept;
+  bool UsesDoublePrecision() const noexcept;
+  int GetSize() const noexcept;
+
+ private:
+  void FallBackToDouble();
+  bool HasConverged(const S21Matrix& solution,
+                    const S21Matrix& residual) const noexcept;
+  S21Matrix Residual(const S21Matrix& rhs, const S21Matrix& solution) const;
+
+  S21Matrix matrix_;
+  std::optional<S21BasicLuDecomposition<float>> lu_;
+  std::optional<S21LuDecomposition> fallback_;
+  double tolerance_;
+  int iterations_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_DECOMPOSITION_H_
@@ -0,0 +1,26 @@
+#include "s21_execution.h"
+
+#include <algorithm>
+
+#include "s21_thread_pool.h"
+
+int S21RowChunkCount(const S21ExecutionPolicy& policy, int rows, int cols) {
+  if (!policy.IsParallel() ||
+      static_cast<std::size_t>(rows) * cols < kS21ParallelElements)
+    return 1;
+  return std::max(1, std::min(S21ThreadPool::Global().GetThreadCount(), rows));
+}
+
+void S21ForEachRowChunk(int chunks, int rows,
+                        const std::function<void(int, int, int)>& task) {
+  if (chunks <= 1) {
+    task(0, 0, rows);
+    return;
+  }
+  int chunk_rows = (rows + chunks - 1) / chunks;
+  S21ThreadPool::Global().ParallelFor(chunks, [&](int chunk) {
+    int begin = chunk * chunk_rows;
+    int end = std::min(rows, begin + chunk_rows);
+    if (begin < end) task(chunk, begin, end);
+  });
+}
@@ -0,0 +1,55 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_EXECUTION_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_EXECUTION_H_
+
+#include <cstddef>
+#include <functional>
+
+// Execution policies, after std::execution, for the element-wise operations
+// and reductions of S21Matrix. The parallel ones split the rows among the
+// threads of S21ThreadPool::Global() once a matrix holds kS21ParallelElements
+// elements; smaller matrices stay in cache and are not worth waking the pool
+// for. Each thread runs the SIMD kernels, so kS21Par and kS21ParUnseq behave
+// alike.
+//
+// <execution> itself is not used: libstdc++ runs it on TBB, which would then
+// have to be linked into every program using the library.
+class S21ExecutionPolicy {
+ public:
+  constexpr bool IsParallel() const noexcept { return parallel_; }
+
+ protected:
+  constexpr explicit S21ExecutionPolicy(bool parallel) noexcept
+      : parallel_(parallel) {}
+
+ private:
+  bool parallel_;
+};
+
+struct S21SequencedPolicy : S21ExecutionPolicy {
+  constexpr S21SequencedPolicy() noexcept : S21ExecutionPolicy(false) {}
+};
+
+struct S21ParallelPolicy : S21ExecutionPolicy {
+  constexpr S21ParallelPolicy() noexcept : S21ExecutionPolicy(true) {}
+};
+
+struct S21ParallelUnsequencedPolicy : S21ExecutionPolicy {
+  constexpr S21ParallelUnsequencedPolicy() noexcept
+      : S21ExecutionPolicy(true) {}
+};
+
+inline constexpr S21SequencedPolicy kS21Seq;
+inline constexpr S21ParallelPolicy kS21Par;
+inline constexpr S21ParallelUnsequencedPolicy kS21ParUnseq;
+
+// 2 MiB of doubles.
+constexpr std::size_t kS21ParallelElements = std::size_t(1) << 18;
+
+// Number of row ranges a rows x cols operation is split into under policy.
+int S21RowChunkCount(const S21ExecutionPolicy& policy, int rows, int cols);
+// Calls task(chunk, begin, end) for chunks consecutive ranges of [0, rows),
+// on the global pool when there is more than one.
+void S21ForEachRowChunk(int chunks, int rows,
+                        const std::function<void(int, int, int)>& task);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_EXECUTION_H_
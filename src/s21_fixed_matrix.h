@@ -0,0 +1,313 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_FIXED_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_FIXED_MATRIX_H_
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// A matrix whose shape is part of its type. Elements live inside the object
+// (no heap allocation), mismatched shapes are rejected at compile time, and
+// Determinant, InverseMatrix and CalcComplements use closed forms up to 4x4.
+template <int R, int C>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0,
+                "Numbers of rows and columns in a matrix must be positive");
+
+ public:
+  constexpr S21FixedMatrix() noexcept : data_{} {}
+  explicit S21FixedMatrix(const S21Matrix& matrix) {
+    if (matrix.GetRows() != R || matrix.GetCols() != C)
+      throw std::logic_error("Matrices must have the same dimensions");
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) data_[i][j] = matrix(i, j);
+    }
+  }
+
+  explicit operator S21Matrix() const {
+    S21Matrix matrix(R, C);
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) matrix(i, j) = data_[i][j];
+    }
+    return matrix;
+  }
+  S21ConstMatrixView View() const noexcept {
+    return S21ConstMatrixView(&data_[0][0], R, C, C, 1);
+  }
+  S21MatrixView View() noexcept {
+    return S21MatrixView(&data_[0][0], R, C, C, 1);
+  }
+
+  static constexpr int GetRows() noexcept { return R; }
+  static constexpr int GetCols() noexcept { return C; }
+
+  double& operator()(int row, int col) {
+    CheckIndexesAreInRange(row, col);
+    return data_[row][col];
+  }
+  const double& operator()(int row, int col) const {
+    CheckIndexesAreInRange(row, col);
+    return data_[row][col];
+  }
+
+  bool EqMatrix(const S21FixedMatrix& other) const noexcept {
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) {
+        if (fabs(data_[i][j] - other.data_[i][j]) > S21_MATRIX_OOP_EPS)
+          return false;
+      }
+    }
+    return true;
+  }
+  void SumMatrix(const S21FixedMatrix& other) noexcept {
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) data_[i][j] += other.data_[i][j];
+    }
+  }
+  void SubMatrix(const S21FixedMatrix& other) noexcept {
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) data_[i][j] -= other.data_[i][j];
+    }
+  }
+  void MulNumber(double num) noexcept {
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) data_[i][j] *= num;
+    }
+  }
+  void MulMatrix(const S21FixedMatrix<C, C>& other) noexcept {
+    *this = *this * other;
+  }
+
+  S21FixedMatrix<C, R> Transpose() const noexcept {
+    S21FixedMatrix<C, R> result;
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) result.data_[j][i] = data_[i][j];
+    }
+    return result;
+  }
+  S21FixedMatrix CalcComplements() const;
+  double Determinant() const noexcept;
+  S21FixedMatrix InverseMatrix() const;
+
+  template <int N>
+  S21FixedMatrix<R, N> operator*(
+      const S21FixedMatrix<C, N>& other) const noexcept {
+    S21FixedMatrix<R, N> result;
+    for (int i = 0; i < R; i++) {
+      for (int k = 0; k < C; k++) {
+        for (int j = 0; j < N; j++) {
+          result.data_[i][j] += data_[i][k] * other.data_[k][j];
+        }
+      }
+    }
+    return result;
+  }
+  bool operator==(const S21FixedMatrix& other) const noexcept {
+    return EqMatrix(other);
+  }
+  S21FixedMatrix& operator+=(const S21FixedMatrix& other) noexcept {
+    SumMatrix(other);
+    return *this;
+  }
+  S21FixedMatrix& operator-=(const S21FixedMatrix& other) noexcept {
+    SubMatrix(other);
+    return *this;
+  }
+  S21FixedMatrix& operator*=(const S21FixedMatrix<C, C>& other) noexcept {
+    MulMatrix(other);
+    return *this;
+  }
+  S21FixedMatrix& operator*=(double num) noexcept {
+    MulNumber(num);
+    return *this;
+  }
+
+ private:
+  template <int, int>
+  friend class S21FixedMatrix;
+
+  void CheckIndexesAreInRange(int row, int col) const {
+    if (row >= R || row < 0 || col >= C || col < 0)
+      throw std::out_of_range("Index is outside the matrix");
+  }
+  S21FixedMatrix Adjugate() const noexcept;
+  double MaxAbsValue() const noexcept {
+    double result = 0;
+    for (int i = 0; i < R; i++) {
+      for (int j = 0; j < C; j++) {
+        result = std::fmax(result, fabs(data_[i][j]));
+      }
+    }
+    return result;
+  }
+
+  double data_[R][C];
+};
+
+template <int R, int C>
+S21FixedMatrix<R, C> operator+(S21FixedMatrix<R, C> left,
+                               const S21FixedMatrix<R, C>& right) noexcept {
+  left.SumMatrix(right);
+  return left;
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> operator-(S21FixedMatrix<R, C> left,
+                               const S21FixedMatrix<R, C>& right) noexcept {
+  left.SubMatrix(right);
+  return left;
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> operator*(S21FixedMatrix<R, C> matrix,
+                               double num) noexcept {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> operator*(double num,
+                               S21FixedMatrix<R, C> matrix) noexcept {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <int R, int C>
+double S21FixedMatrix<R, C>::Determinant() const noexcept {
+  static_assert(R == C, "The matrix is not square");
+  const auto& a = data_;
+  if constexpr (R == 1) {
+    return a[0][0];
+  } else if constexpr (R == 2) {
+    return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+  } else if constexpr (R == 3) {
+    return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+           a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+           a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+  } else if constexpr (R == 4) {
+    double s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    double s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    double s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    double s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    double s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    double s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+    double c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    double c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    double c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    double c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    double c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    double c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  } else {
+    S21FixedMatrix lu = *this;
+    double result = 1;
+    for (int k = 0; k < R; k++) {
+      int pivot = k;
+      for (int i = k + 1; i < R; i++) {
+        if (fabs(lu.data_[i][k]) > fabs(lu.data_[pivot][k])) pivot = i;
+      }
+      if (lu.data_[pivot][k] == 0) return 0;
+      if (pivot != k) {
+        std::swap(lu.data_[pivot], lu.data_[k]);
+        result = -result;
+      }
+      result *= lu.data_[k][k];
+      for (int i = k + 1; i < R; i++) {
+        double factor = lu.data_[i][k] / lu.data_[k][k];
+        for (int j = k + 1; j < R; j++) {
+          lu.data_[i][j] -= factor * lu.data_[k][j];
+        }
+      }
+    }
+    return result;
+  }
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::Adjugate() const noexcept {
+  static_assert(R == C && R <= 4);
+  const auto& a = data_;
+  S21FixedMatrix result;
+  auto& b = result.data_;
+  if constexpr (R == 1) {
+    b[0][0] = 1;
+  } else if constexpr (R == 2) {
+    b[0][0] = a[1][1];
+    b[0][1] = -a[0][1];
+    b[1][0] = -a[1][0];
+    b[1][1] = a[0][0];
+  } else if constexpr (R == 3) {
+    b[0][0] = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+    b[0][1] = a[0][2] * a[2][1] - a[0][1] * a[2][2];
+    b[0][2] = a[0][1] * a[1][2] - a[0][2] * a[1][1];
+    b[1][0] = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+    b[1][1] = a[0][0] * a[2][2] - a[0][2] * a[2][0];
+    b[1][2] = a[0][2] * a[1][0] - a[0][0] * a[1][2];
+    b[2][0] = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+    b[2][1] = a[0][1] * a[2][0] - a[0][0] * a[2][1];
+    b[2][2] = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+  } else {
+    double s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    double s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    double s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    double s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    double s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    double s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+    double c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    double c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    double c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    double c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    double c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    double c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+    b[0][0] = a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3;
+    b[0][1] = -a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3;
+    b[0][2] = a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3;
+    b[0][3] = -a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3;
+    b[1][0] = -a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1;
+    b[1][1] = a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1;
+    b[1][2] = -a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1;
+    b[1][3] = a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1;
+    b[2][0] = a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0;
+    b[2][1] = -a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0;
+    b[2][2] = a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0;
+    b[2][3] = -a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0;
+    b[3][0] = -a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0;
+    b[3][1] = a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0;
+    b[3][2] = -a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0;
+    b[3][3] = a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0;
+  }
+  return result;
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::CalcComplements() const {
+  static_assert(R == C, "The matrix is not square");
+  if constexpr (R <= 4) {
+    return Adjugate().Transpose();
+  } else {
+    return S21FixedMatrix(static_cast<S21Matrix>(*this).CalcComplements());
+  }
+}
+
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::InverseMatrix() const {
+  static_assert(R == C, "The matrix is not square");
+  if constexpr (R <= 4) {
+    double determinant = Determinant();
+    double scale = MaxAbsValue();
+    // A small |det| relative to max|a|^n means a singular or merely badly
+    // scaled matrix; the pivoted LU tells them apart, as for S21Matrix.
+    if (!(fabs(determinant) >
+          R * std::numeric_limits<double>::epsilon() * std::pow(scale, R)))
+      return S21FixedMatrix(static_cast<S21Matrix>(*this).InverseMatrix());
+    S21FixedMatrix result = Adjugate();
+    result.MulNumber(1.0 / determinant);
+    return result;
+  } else {
+    return S21FixedMatrix(static_cast<S21Matrix>(*this).InverseMatrix());
+  }
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_FIXED_MATRIX_H_
@@ -0,0 +1,268 @@
+#include "s21_gemm.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define S21_GEMM_HAVE_AVX2_KERNEL
+#endif
+
+namespace {
+
+// Register tiles hold kMr rows of kNr columns; float tiles are twice as wide
+// so that a tile takes as many vector registers as a double one.
+template <typename T>
+struct Tile;
+
+template <>
+struct Tile<double> {
+  static constexpr int kMr = 4;
+  static constexpr int kNr = 8;
+};
+
+template <>
+struct Tile<float> {
+  static constexpr int kMr = 4;
+  static constexpr int kNr = 16;
+};
+
+constexpr int kMc = 96;
+constexpr int kKc = 256;
+constexpr int kNc = 2048;
+constexpr long kSmallProductSize = 32 * 32 * 32;
+constexpr long kParallelProductSize = 128 * 128 * 128;
+
+template <typename T>
+struct Operand {
+  const T* data;
+  std::ptrdiff_t row_stride;
+  std::ptrdiff_t col_stride;
+
+  T operator()(int row, int col) const {
+    return data[row * row_stride + col * col_stride];
+  }
+};
+
+template <typename T>
+void PackA(int mc, int kc, const Operand<T>& a, T* packed) {
+  constexpr int kMr = Tile<T>::kMr;
+  for (int i = 0; i < mc; i += kMr) {
+    int mr = std::min(kMr, mc - i);
+    for (int p = 0; p < kc; p++) {
+      for (int ii = 0; ii < mr; ii++) *packed++ = a(i + ii, p);
+      for (int ii = mr; ii < kMr; ii++) *packed++ = 0;
+    }
+  }
+}
+
+template <typename T>
+void PackB(int kc, int nc, const Operand<T>& b, T* packed) {
+  constexpr int kNr = Tile<T>::kNr;
+  for (int j = 0; j < nc; j += kNr) {
+    int nr = std::min(kNr, nc - j);
+    for (int p = 0; p < kc; p++) {
+      for (int jj = 0; jj < nr; jj++) *packed++ = b(p, j + jj);
+      for (int jj = nr; jj < kNr; jj++) *packed++ = 0;
+    }
+  }
+}
+
+template <typename T, typename Vector>
+inline __attribute__((always_inline)) void MicroKernelBody(
+    int kc, const T* a, const T* b, T* c, std::ptrdiff_t ldc, int mr, int nr,
+    T alpha) {
+  constexpr int kMr = Tile<T>::kMr;
+  constexpr int kNr = Tile<T>::kNr;
+  constexpr int kLanes = sizeof(Vector) / sizeof(T);
+  Vector acc[kMr][kNr / kLanes] = {};
+  for (int p = 0; p < kc; p++) {
+    Vector b_values[kNr / kLanes];
+#pragma GCC unroll 8
+    for (int j = 0; j < kNr / kLanes; j++) {
+      std::memcpy(&b_values[j], b + j * kLanes, sizeof(Vector));
+    }
+#pragma GCC unroll 8
+    for (int i = 0; i < kMr; i++) {
+      Vector a_value = Vector{} + a[i];
+#pragma GCC unroll 8
+      for (int j = 0; j < kNr / kLanes; j++) {
+        acc[i][j] += a_value * b_values[j];
+      }
+    }
+    a += kMr;
+    b += kNr;
+  }
+  for (int i = 0; i < mr; i++) {
+    T row[kNr];
+    std::memcpy(row, acc[i], sizeof(row));
+    for (int j = 0; j < nr; j++) c[i * ldc + j] += alpha * row[j];
+  }
+}
+
+typedef double Vector2 __attribute__((vector_size(2 * sizeof(double))));
+typedef double Vector4 __attribute__((vector_size(4 * sizeof(double))));
+typedef float Vector4f __attribute__((vector_size(4 * sizeof(float))));
+typedef float Vector8f __attribute__((vector_size(8 * sizeof(float))));
+
+template <typename T>
+using MicroKernelFunction = void (*)(int, const T*, const T*, T*,
+                                     std::ptrdiff_t, int, int, T);
+
+void MicroKernelGeneric(int kc, const double* a, const double* b, double* c,
+                        std::ptrdiff_t ldc, int mr, int nr, double alpha) {
+  MicroKernelBody<double, Vector2>(kc, a, b, c, ldc, mr, nr, alpha);
+}
+
+void MicroKernelGeneric(int kc, const float* a, const float* b, float* c,
+                        std::ptrdiff_t ldc, int mr, int nr, float alpha) {
+  MicroKernelBody<float, Vector4f>(kc, a, b, c, ldc, mr, nr, alpha);
+}
+
+#ifdef S21_GEMM_HAVE_AVX2_KERNEL
+__attribute__((target("avx2,fma"))) void MicroKernelAvx2(
+    int kc, const double* a, const double* b, double* c, std::ptrdiff_t ldc,
+    int mr, int nr, double alpha) {
+  MicroKernelBody<double, Vector4>(kc, a, b, c, ldc, mr, nr, alpha);
+}
+
+__attribute__((target("avx2,fma"))) void MicroKernelAvx2(
+    int kc, const float* a, const float* b, float* c, std::ptrdiff_t ldc,
+    int mr, int nr, float alpha) {
+  MicroKernelBody<float, Vector8f>(kc, a, b, c, ldc, mr, nr, alpha);
+}
+#endif
+
+template <typename T>
+MicroKernelFunction<T> SelectMicroKernel() {
+#ifdef S21_GEMM_HAVE_AVX2_KERNEL
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return MicroKernelAvx2;
+  }
+#endif
+  return MicroKernelGeneric;
+}
+
+template <typename T>
+void MacroKernel(int mc, int nc, int kc, const T* packed_a, const T* packed_b,
+                 T* c, std::ptrdiff_t ldc, T alpha) {
+  constexpr int kMr = Tile<T>::kMr;
+  constexpr int kNr = Tile<T>::kNr;
+  static const MicroKernelFunction<T> micro_kernel = SelectMicroKernel<T>();
+  for (int j = 0; j < nc; j += kNr) {
+    int nr = std::min(kNr, nc - j);
+    for (int i = 0; i < mc; i += kMr) {
+      int mr = std::min(kMr, mc - i);
+      micro_kernel(kc, packed_a + i * kc, packed_b + j * kc, c + i * ldc + j,
+                   ldc, mr, nr, alpha);
+    }
+  }
+}
+
+template <typename T>
+void SmallGemm(int m, int n, int k, const Operand<T>& a, const Operand<T>& b,
+               T* c, std::ptrdiff_t ldc, T alpha) {
+  for (int i = 0; i < m; i++) {
+    T* c_row = c + i * ldc;
+    for (int p = 0; p < k; p++) {
+      T a_value = alpha * a(i, p);
+      for (int j = 0; j < n; j++) c_row[j] += a_value * b(p, j);
+    }
+  }
+}
+
+template <typename T>
+void GemmSerial(int m, int n, int k, const Operand<T>& a, const Operand<T>& b,
+                T* c, std::ptrdiff_t ldc, T alpha) {
+  if (static_cast<long>(m) * n * k <= kSmallProductSize) {
+    SmallGemm(m, n, k, a, b, c, ldc, alpha);
+    return;
+  }
+
+  thread_local std::vector<T> packed_a;
+  thread_local std::vector<T> packed_b;
+  packed_a.resize(static_cast<std::size_t>(kMc) * kKc);
+  packed_b.resize(static_cast<std::size_t>(kKc) * kNc);
+
+  for (int jc = 0; jc < n; jc += kNc) {
+    int nc = std::min(kNc, n - jc);
+    for (int pc = 0; pc < k; pc += kKc) {
+      int kc = std::min(kKc, k - pc);
+      Operand<T> b_block{b.data + pc * b.row_stride + jc * b.col_stride,
+                         b.row_stride, b.col_stride};
+      PackB(kc, nc, b_block, packed_b.data());
+      for (int ic = 0; ic < m; ic += kMc) {
+        int mc = std::min(kMc, m - ic);
+        Operand<T> a_block{a.data + ic * a.row_stride + pc * a.col_stride,
+                           a.row_stride, a.col_stride};
+        PackA(mc, kc, a_block, packed_a.data());
+        MacroKernel(mc, nc, kc, packed_a.data(), packed_b.data(),
+                    c + ic * ldc + jc, ldc, alpha);
+      }
+    }
+  }
+}
+
+template <typename T>
+void GemmParallel(int m, int n, int k, const Operand<T>& a,
+                  const Operand<T>& b, T* c, std::ptrdiff_t ldc, T alpha,
+                  S21ThreadPool& pool) {
+  bool split_rows = m >= n;
+  int granularity = split_rows ? Tile<T>::kMr : Tile<T>::kNr;
+  int extent = split_rows ? m : n;
+  int blocks = (extent + granularity - 1) / granularity;
+  int chunks = std::min(pool.GetThreadCount(), blocks);
+  int chunk_size = (blocks + chunks - 1) / chunks * granularity;
+
+  pool.ParallelFor(chunks, [&](int chunk) {
+    int begin = chunk * chunk_size;
+    int size = std::min(chunk_size, extent - begin);
+    if (size <= 0) return;
+    if (split_rows) {
+      Operand<T> a_panel{a.data + begin * a.row_stride, a.row_stride,
+                         a.col_stride};
+      GemmSerial(size, n, k, a_panel, b, c + begin * ldc, ldc, alpha);
+    } else {
+      Operand<T> b_panel{b.data + begin * b.col_stride, b.row_stride,
+                         b.col_stride};
+      GemmSerial(m, size, k, a, b_panel, c + begin, ldc, alpha);
+    }
+  });
+}
+
+template <typename T>
+void Gemm(int m, int n, int k, const T* a, std::ptrdiff_t a_row_stride,
+          std::ptrdiff_t a_col_stride, const T* b, std::ptrdiff_t b_row_stride,
+          std::ptrdiff_t b_col_stride, T* c, std::ptrdiff_t ldc, T alpha) {
+  if (m <= 0 || n <= 0 || k <= 0) return;
+  Operand<T> op_a{a, a_row_stride, a_col_stride};
+  Operand<T> op_b{b, b_row_stride, b_col_stride};
+
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  if (pool.GetThreadCount() > 1 &&
+      static_cast<long>(m) * n * k >= kParallelProductSize) {
+    GemmParallel(m, n, k, op_a, op_b, c, ldc, alpha, pool);
+  } else {
+    GemmSerial(m, n, k, op_a, op_b, c, ldc, alpha);
+  }
+}
+
+}  // namespace
+
+void S21Gemm(int m, int n, int k, const double* a, std::ptrdiff_t a_row_stride,
+             std::ptrdiff_t a_col_stride, const double* b,
+             std::ptrdiff_t b_row_stride, std::ptrdiff_t b_col_stride,
+             double* c, std::ptrdiff_t ldc, double alpha) {
+  Gemm(m, n, k, a, a_row_stride, a_col_stride, b, b_row_stride, b_col_stride,
+       c, ldc, alpha);
+}
+
+void S21Gemm(int m, int n, int k, const float* a, std::ptrdiff_t a_row_stride,
+             std::ptrdiff_t a_col_stride, const float* b,
+             std::ptrdiff_t b_row_stride, std::ptrdiff_t b_col_stride, float* c,
+             std::ptrdiff_t ldc, float alpha) {
+  Gemm(m, n, k, a, a_row_stride, a_col_stride, b, b_row_stride, b_col_stride,
+       c, ldc, alpha);
+}
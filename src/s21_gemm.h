@@ -0,0 +1,19 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_GEMM_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_GEMM_H_
+
+#include <cstddef>
+
+// C += alpha * A * B, where A is m x k, B is k x n and C is m x n. A and B are
+// addressed through independent row and column strides, so transposed or
+// strided operands can be passed without copying; C is row-major with row
+// stride ldc.
+void S21Gemm(int m, int n, int k, const double* a, std::ptrdiff_t a_row_stride,
+             std::ptrdiff_t a_col_stride, const double* b,
+             std::ptrdiff_t b_row_stride, std::ptrdiff_t b_col_stride,
+             double* c, std::ptrdiff_t ldc, double alpha = 1.0);
+void S21Gemm(int m, int n, int k, const float* a, std::ptrdiff_t a_row_stride,
+             std::ptrdiff_t a_col_stride, const float* b,
+             std::ptrdiff_t b_row_stride, std::ptrdiff_t b_col_stride, float* c,
+             std::ptrdiff_t ldc, float alpha = 1.0f);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_GEMM_H_
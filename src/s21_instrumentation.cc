@@ -0,0 +1,202 @@
+#include "s21_instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+enum Field { kCalls, kFlops, kBytesAllocated, kNanoseconds, kFieldCount };
+
+struct ThreadCounters {
+  std::atomic<std::uint64_t> values[kS21OperationCount][kFieldCount];
+};
+
+// Owns the counters of finished threads and tracks those of live ones. It is
+// never destroyed, so threads that exit during static destruction can still
+// retire their counters.
+class CounterRegistry {
+ public:
+  void Register(ThreadCounters* counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_.push_back(counters);
+  }
+
+  void Retire(ThreadCounters* counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < kS21OperationCount; i++) {
+      for (int field = 0; field < kFieldCount; field++) {
+        retired_[i][field] +=
+            counters->values[i][field].load(std::memory_order_relaxed);
+      }
+    }
+    live_.erase(std::find(live_.begin(), live_.end(), counters));
+  }
+
+  S21InstrumentationSnapshot Snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::uint64_t totals[kS21OperationCount][kFieldCount];
+    std::memcpy(totals, retired_, sizeof(totals));
+    for (ThreadCounters* counters : live_) {
+      for (std::size_t i = 0; i < kS21OperationCount; i++) {
+        for (int field = 0; field < kFieldCount; field++) {
+          totals[i][field] +=
+              counters->values[i][field].load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    S21InstrumentationSnapshot snapshot;
+    for (std::size_t i = 0; i < kS21OperationCount; i++) {
+      snapshot.operations[i] = {totals[i][kCalls], totals[i][kFlops],
+                                totals[i][kBytesAllocated],
+                                totals[i][kNanoseconds]};
+    }
+    return snapshot;
+  }
+
+  void Reset() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::memset(retired_, 0, sizeof(retired_));
+    for (ThreadCounters* counters : live_) {
+      for (auto& operation : counters->values) {
+        for (auto& value : operation) {
+          value.store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<ThreadCounters*> live_;
+  std::uint64_t retired_[kS21OperationCount][kFieldCount] = {};
+};
+
+CounterRegistry& Registry() {
+  static CounterRegistry* registry = new CounterRegistry();
+  return *registry;
+}
+
+class ThreadSlot {
+ public:
+  ThreadSlot() : counters_() { Registry().Register(&counters_); }
+  ~ThreadSlot() { Registry().Retire(&counters_); }
+
+  // Only the owning thread writes its counters, so a plain load and store
+  // suffice; atomics merely keep concurrent snapshots well defined.
+  void Add(S21Operation operation, Field field, std::uint64_t value) noexcept {
+    std::atomic<std::uint64_t>& counter =
+        counters_.values[static_cast<std::size_t>(operation)][field];
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+  }
+
+ private:
+  ThreadCounters counters_;
+};
+
+ThreadSlot& LocalSlot() {
+  thread_local ThreadSlot slot;
+  return slot;
+}
+
+thread_local S21Operation current_operation = S21Operation::kOther;
+
+const char* const kOperationNames[kS21OperationCount] = {
+    "Other",       "Copy",          "EqMatrix",        "SumMatrix",
+    "SubMatrix",   "MulNumber",     "MulMatrix",       "Transpose",
+    "Determinant", "InverseMatrix", "CalcComplements", "Solve",
+    "Resize",      "Expression"};
+
+}  // namespace
+
+const char* S21OperationName(S21Operation operation) noexcept {
+  return kOperationNames[static_cast<std::size_t>(operation)];
+}
+
+std::string S21InstrumentationSnapshot::ToJson() const {
+  std::ostringstream out;
+  out.precision(9);
+  out << "{\"operations\": {";
+  for (std::size_t i = 0; i < kS21OperationCount; i++) {
+    const S21OperationStats& stats = operations[i];
+    out << (i ? ", " : "") << '"' << kOperationNames[i] << "\": {"
+        << "\"calls\": " << stats.calls << ", \"flops\": " << stats.flops
+        << ", \"bytes_allocated\": " << stats.bytes_allocated
+        << ", \"seconds\": " << stats.nanoseconds * 1e-9 << '}';
+  }
+  out << "}}";
+  return out.str();
+}
+
+std::string S21InstrumentationSnapshot::ToPrometheus() const {
+  struct Metric {
+    const char* name;
+    const char* help;
+    std::uint64_t S21OperationStats::*field;
+    double scale;
+  };
+  static const Metric kMetrics[] = {
+      {"s21_matrix_operation_calls_total", "Calls of each operation.",
+       &S21OperationStats::calls, 1},
+      {"s21_matrix_operation_flops_total",
+       "Floating-point operations done by each operation.",
+       &S21OperationStats::flops, 1},
+      {"s21_matrix_operation_allocated_bytes_total",
+       "Bytes of matrix storage allocated by each operation.",
+       &S21OperationStats::bytes_allocated, 1},
+      {"s21_matrix_operation_seconds_total",
+       "Wall time spent in each operation.", &S21OperationStats::nanoseconds,
+       1e-9}};
+
+  std::ostringstream out;
+  out.precision(9);
+  for (const Metric& metric : kMetrics) {
+    out << "# HELP " << metric.name << ' ' << metric.help << '\n'
+        << "# TYPE " << metric.name << " counter\n";
+    for (std::size_t i = 0; i < kS21OperationCount; i++) {
+      out << metric.name << "{operation=\"" << kOperationNames[i] << "\"} ";
+      std::uint64_t value = operations[i].*metric.field;
+      if (metric.scale == 1) {
+        out << value;
+      } else {
+        out << value * metric.scale;
+      }
+      out << '\n';
+    }
+  }
+  return out.str();
+}
+
+S21InstrumentationSnapshot S21TakeInstrumentationSnapshot() {
+  return Registry().Snapshot();
+}
+
+void S21ResetInstrumentation() noexcept { Registry().Reset(); }
+
+S21OperationScope::S21OperationScope(S21Operation operation,
+                                     double flops) noexcept
+    : operation_(operation),
+      outer_operation_(current_operation),
+      start_(std::chrono::steady_clock::now()) {
+  current_operation = operation;
+  ThreadSlot& slot = LocalSlot();
+  slot.Add(operation, kCalls, 1);
+  slot.Add(operation, kFlops, static_cast<std::uint64_t>(flops));
+}
+
+S21OperationScope::~S21OperationScope() {
+  auto elapsed = std::chrono::steady_clock::now() - start_;
+  LocalSlot().Add(
+      operation_, kNanoseconds,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  current_operation = outer_operation_;
+}
+
+void S21RecordAllocation(std::size_t bytes) noexcept {
+  LocalSlot().Add(current_operation, kBytesAllocated, bytes);
+}
@@ -0,0 +1,97 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_INSTRUMENTATION_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_INSTRUMENTATION_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Per-operation counters for S21Matrix: calls, floating-point operations,
+// bytes allocated and wall time. Recording is compiled in only when
+// S21_MATRIX_INSTRUMENTATION is defined; otherwise the hooks expand to
+// nothing and every snapshot is zero.
+//
+// Operations may nest (CalcComplements transposes and scales, for example);
+// each level is counted with its inclusive time, while an allocation is
+// charged to the innermost operation only, or to kOther outside of any.
+enum class S21Operation {
+  kOther,
+  kCopy,
+  kEqMatrix,
+  kSumMatrix,
+  kSubMatrix,
+  kMulNumber,
+  kMulMatrix,
+  kTranspose,
+  kDeterminant,
+  kInverseMatrix,
+  kCalcComplements,
+  kSolve,
+  kResize,
+  // Evaluation of a lazy element-wise expression (s21_matrix_expression.h).
+  kExpression,
+  kCount
+};
+
+constexpr std::size_t kS21OperationCount =
+    static_cast<std::size_t>(S21Operation::kCount);
+
+const char* S21OperationName(S21Operation operation) noexcept;
+
+constexpr bool S21InstrumentationEnabled() noexcept {
+#ifdef S21_MATRIX_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+struct S21OperationStats {
+  std::uint64_t calls;
+  std::uint64_t flops;
+  std::uint64_t bytes_allocated;
+  std::uint64_t nanoseconds;
+};
+
+// Counters of all threads, live and finished, summed at one moment.
+struct S21InstrumentationSnapshot {
+  std::array<S21OperationStats, kS21OperationCount> operations;
+
+  const S21OperationStats& operator[](S21Operation operation) const noexcept {
+    return operations[static_cast<std::size_t>(operation)];
+  }
+  std::string ToJson() const;
+  std::string ToPrometheus() const;
+};
+
+S21InstrumentationSnapshot S21TakeInstrumentationSnapshot();
+// Operations running on other threads meanwhile may keep part of their counts.
+void S21ResetInstrumentation() noexcept;
+
+// Each thread records into its own counters, which snapshots merge.
+class S21OperationScope {
+ public:
+  S21OperationScope(S21Operation operation, double flops) noexcept;
+  S21OperationScope(const S21OperationScope&) = delete;
+  S21OperationScope& operator=(const S21OperationScope&) = delete;
+  ~S21OperationScope();
+
+ private:
+  S21Operation operation_;
+  S21Operation outer_operation_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+void S21RecordAllocation(std::size_t bytes) noexcept;
+
+#ifdef S21_MATRIX_INSTRUMENTATION
+#define S21_INSTRUMENT_OPERATION(operation, flops) \
+  S21OperationScope s21_operation_scope(S21Operation::operation, (flops))
+#define S21_INSTRUMENT_ALLOCATION(bytes) S21RecordAllocation(bytes)
+#else
+#define S21_INSTRUMENT_OPERATION(operation, flops) ((void)0)
+#define S21_INSTRUMENT_ALLOCATION(bytes) ((void)0)
+#endif
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_INSTRUMENTATION_H_
@@ -0,0 +1,91 @@
+#include "s21_matrix_arena.h"
+
+#include <algorithm>
+#include <new>
+
+#include "s21_simd.h"
+
+namespace {
+
+thread_local S21MatrixArena* current_arena = nullptr;
+
+std::size_t AlignUp(std::size_t bytes) {
+  return (bytes + kS21SimdAlignment - 1) / kS21SimdAlignment *
+         kS21SimdAlignment;
+}
+
+}  // namespace
+
+S21MatrixArena::S21MatrixArena(std::size_t block_size)
+    : block_size_(AlignUp(std::max<std::size_t>(block_size, 1))),
+      current_block_(0),
+      top_(nullptr),
+      end_(nullptr),
+      last_allocation_(nullptr),
+      bytes_in_use_(0) {}
+
+S21MatrixArena::~S21MatrixArena() {
+  for (const Block& block : blocks_) {
+    ::operator delete[](block.data, std::align_val_t(kS21SimdAlignment));
+  }
+}
+
+double* S21MatrixArena::Allocate(std::size_t size) {
+  std::size_t bytes = AlignUp(std::max<std::size_t>(size, 1) * sizeof(double));
+  if (static_cast<std::size_t>(end_ - top_) < bytes) {
+    std::size_t next = blocks_.empty() ? 0 : current_block_ + 1;
+    while (next < blocks_.size() && blocks_[next].size < bytes) next++;
+    if (next == blocks_.size()) {
+      std::size_t block_bytes = std::max(block_size_, bytes);
+      char* data = static_cast<char*>(
+          ::operator new[](block_bytes, std::align_val_t(kS21SimdAlignment)));
+      blocks_.push_back({data, block_bytes});
+    }
+    StartBlock(next);
+  }
+  last_allocation_ = top_;
+  top_ += bytes;
+  bytes_in_use_ += bytes;
+  return reinterpret_cast<double*>(last_allocation_);
+}
+
+void S21MatrixArena::Deallocate(double* buffer) noexcept {
+  char* data = reinterpret_cast<char*>(buffer);
+  if (data && data == last_allocation_) {
+    bytes_in_use_ -= top_ - data;
+    top_ = data;
+    last_allocation_ = nullptr;
+  }
+}
+
+void S21MatrixArena::Reset() noexcept {
+  bytes_in_use_ = 0;
+  last_allocation_ = nullptr;
+  if (blocks_.empty()) return;
+  StartBlock(0);
+}
+
+std::size_t S21MatrixArena::GetBytesInUse() const noexcept {
+  return bytes_in_use_;
+}
+
+std::size_t S21MatrixArena::GetBytesReserved() const noexcept {
+  std::size_t bytes = 0;
+  for (const Block& block : blocks_) bytes += block.size;
+  return bytes;
+}
+
+S21MatrixArena* S21MatrixArena::Current() noexcept { return current_arena; }
+
+void S21MatrixArena::StartBlock(std::size_t index) noexcept {
+  current_block_ = index;
+  top_ = blocks_[index].data;
+  end_ = top_ + blocks_[index].size;
+}
+
+S21MatrixArenaScope::S21MatrixArenaScope(S21MatrixArena& arena) noexcept
+    : previous_(current_arena) {
+  current_arena = &arena;
+}
+
+S21MatrixArenaScope::~S21MatrixArenaScope() { current_arena = previous_; }
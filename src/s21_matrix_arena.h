@@ -0,0 +1,64 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ARENA_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ARENA_H_
+
+#include <cstddef>
+#include <vector>
+
+// A bump allocator for matrix storage. While an S21MatrixArenaScope is alive
+// on a thread, every S21Matrix created on that thread takes its buffer from
+// the scope's arena instead of the heap. Buffers are released all at once by
+// Reset() or by destroying the arena; freeing the most recent buffer hands its
+// space straight back, so short-lived temporaries are reused in place.
+// A matrix stays with the storage it was created with: resizing, assigning
+// to or multiplying into a matrix from outside the scope keeps it on the heap.
+// Matrices must not outlive the arena (or its next Reset) they were created
+// in, and an arena must only be used from one thread at a time.
+class S21MatrixArena {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = std::size_t(1) << 20;
+
+  explicit S21MatrixArena(std::size_t block_size = kDefaultBlockSize);
+  S21MatrixArena(const S21MatrixArena&) = delete;
+  S21MatrixArena& operator=(const S21MatrixArena&) = delete;
+  ~S21MatrixArena();
+
+  double* Allocate(std::size_t size);
+  void Deallocate(double* buffer) noexcept;
+  void Reset() noexcept;
+
+  std::size_t GetBytesInUse() const noexcept;
+  std::size_t GetBytesReserved() const noexcept;
+
+  static S21MatrixArena* Current() noexcept;
+
+ private:
+  friend class S21MatrixArenaScope;
+
+  struct Block {
+    char* data;
+    std::size_t size;
+  };
+
+  void StartBlock(std::size_t index) noexcept;
+
+  std::size_t block_size_;
+  std::vector<Block> blocks_;
+  std::size_t current_block_;
+  char* top_;
+  char* end_;
+  char* last_allocation_;
+  std::size_t bytes_in_use_;
+};
+
+class S21MatrixArenaScope {
+ public:
+  explicit S21MatrixArenaScope(S21MatrixArena& arena) noexcept;
+  S21MatrixArenaScope(const S21MatrixArenaScope&) = delete;
+  S21MatrixArenaScope& operator=(const S21MatrixArenaScope&) = delete;
+  ~S21MatrixArenaScope();
+
+ private:
+  S21MatrixArena* previous_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ARENA_H_
@@ -0,0 +1,398 @@
+#include "s21_matrix_batch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define S21_BATCH_HAVE_X86_KERNELS
+#endif
+
+namespace {
+
+constexpr int kParallelCount = 1 << 12;
+
+// The kernels see one lane group at a time: lanes are matrices of the batch,
+// consecutive in memory for every element, `padded` doubles apart between
+// elements. Singular lanes are reported as non-zero entries of `singular`.
+struct BatchShape {
+  int rows;
+  int inner;
+  int cols;
+  std::ptrdiff_t padded;
+};
+
+// Vectors are only passed by reference so that the helpers, which are not
+// compiled for any particular ISA, do not change the ABI of wider vectors.
+template <typename Vector>
+inline __attribute__((always_inline)) void Load(Vector& value,
+                                                const double* data) {
+  std::memcpy(&value, data, sizeof(Vector));
+}
+
+template <typename Vector>
+inline __attribute__((always_inline)) void Store(double* data,
+                                                 const Vector& value) {
+  std::memcpy(data, &value, sizeof(Vector));
+}
+
+template <typename Vector>
+inline __attribute__((always_inline)) void MulBody(const BatchShape& shape,
+                                                   int begin, int end,
+                                                   const double* a,
+                                                   const double* b,
+                                                   double* c) {
+  constexpr int kLanes = sizeof(Vector) / sizeof(double);
+  for (int lane = begin; lane < end; lane += kLanes) {
+    for (int i = 0; i < shape.rows; i++) {
+      for (int j = 0; j < shape.cols; j++) {
+        Vector acc = {}, left, right;
+        for (int k = 0; k < shape.inner; k++) {
+          Load(left, a + (i * shape.inner + k) * shape.padded + lane);
+          Load(right, b + (k * shape.cols + j) * shape.padded + lane);
+          acc += left * right;
+        }
+        Store(c + (i * shape.cols + j) * shape.padded + lane, acc);
+      }
+    }
+  }
+}
+
+// Exchanges rows `k` and `r` of a lane-major n x n block in the lanes selected
+// by `exchange`, starting from column `first_col`.
+template <typename Vector, typename Mask>
+inline __attribute__((always_inline)) void ExchangeRows(double* block, int n,
+                                                        int k, int r,
+                                                        int first_col,
+                                                        const Mask& exchange) {
+  constexpr int kLanes = sizeof(Vector) / sizeof(double);
+  for (int c = first_col; c < n; c++) {
+    double* top_data = block + (k * n + c) * kLanes;
+    double* bottom_data = block + (r * n + c) * kLanes;
+    Vector top, bottom;
+    Load(top, top_data);
+    Load(bottom, bottom_data);
+    Vector new_top = exchange ? bottom : top;
+    Vector new_bottom = exchange ? top : bottom;
+    Store(top_data, new_top);
+    Store(bottom_data, new_bottom);
+  }
+}
+
+// Row `r` -= factor * row `k` of a lane-major n x n block from `first_col`.
+template <typename Vector>
+inline __attribute__((always_inline)) void EliminateRow(double* block, int n,
+                                                        int k, int r,
+                                                        int first_col,
+                                                        const Vector& factor) {
+  constexpr int kLanes = sizeof(Vector) / sizeof(double);
+  for (int c = first_col; c < n; c++) {
+    Vector target, source;
+    Load(target, block + (r * n + c) * kLanes);
+    Load(source, block + (k * n + c) * kLanes);
+    target -= factor * source;
+    Store(block + (r * n + c) * kLanes, target);
+  }
+}
+
+template <typename Vector>
+inline __attribute__((always_inline)) void ScaleRow(double* block, int n,
+                                                    int k, int first_col,
+                                                    const Vector& factor) {
+  constexpr int kLanes = sizeof(Vector) / sizeof(double);
+  for (int c = first_col; c < n; c++) {
+    Vector value;
+    Load(value, block + (k * n + c) * kLanes);
+    value *= factor;
+    Store(block + (k * n + c) * kLanes, value);
+  }
+}
+
+// Gauss-Jordan elimination with partial pivoting carried out independently in
+// every lane: rows are exchanged lane by lane with selects, so all lanes run
+// the same instructions. With `inverse` null only the determinant is formed.
+template <typename Vector>
+inline __attribute__((always_inline)) void EliminateBody(
+    const BatchShape& shape, int begin, int end, const double* a,
+    double* inverse, double* determinant, long* singular, double* work) {
+  constexpr int kLanes = sizeof(Vector) / sizeof(double);
+  const int n = shape.rows;
+  double* m = work;
+  double* x = work + n * n * kLanes;
+  const double tolerance_factor = n * std::numeric_limits<double>::epsilon();
+
+  for (int lane = begin; lane < end; lane += kLanes) {
+    Vector scale = {};
+    for (int e = 0; e < n * n; e++) {
+      Vector value;
+      Load(value, a + e * shape.padded + lane);
+      Vector magnitude = value < 0 ? -value : value;
+      scale = magnitude > scale ? magnitude : scale;
+      Store(m + e * kLanes, value);
+      if (inverse) {
+        Vector identity = Vector{} + (e % (n + 1) == 0 ? 1.0 : 0.0);
+        Store(x + e * kLanes, identity);
+      }
+    }
+    Vector tolerance = scale * tolerance_factor;
+    Vector det = Vector{} + 1.0;
+    auto is_singular = Vector{} != Vector{};
+
+    for (int k = 0; k < n; k++) {
+      for (int r = k + 1; r < n; r++) {
+        Vector best, candidate;
+        Load(best, m + (k * n + k) * kLanes);
+        Load(candidate, m + (r * n + k) * kLanes);
+        best = best < 0 ? -best : best;
+        candidate = candidate < 0 ? -candidate : candidate;
+        auto exchange = candidate > best;
+        det = exchange ? -det : det;
+        ExchangeRows<Vector>(m, n, k, r, k, exchange);
+        if (inverse) ExchangeRows<Vector>(x, n, k, r, 0, exchange);
+      }
+
+      Vector pivot;
+      Load(pivot, m + (k * n + k) * kLanes);
+      Vector magnitude = pivot < 0 ? -pivot : pivot;
+      is_singular |= magnitude <= tolerance;
+      det *= pivot;
+      // A zero pivot column leaves the lane untouched and its determinant 0.
+      Vector reciprocal = pivot == 0 ? Vector{} : 1.0 / pivot;
+      for (int r = inverse ? 0 : k + 1; r < n; r++) {
+        if (r == k) continue;
+        Vector factor;
+        Load(factor, m + (r * n + k) * kLanes);
+        factor *= reciprocal;
+        EliminateRow(m, n, k, r, k + 1, factor);
+        if (inverse) EliminateRow(x, n, k, r, 0, factor);
+      }
+      if (inverse) {
+        ScaleRow(m, n, k, k + 1, reciprocal);
+        ScaleRow(x, n, k, 0, reciprocal);
+      }
+    }
+
+    if (inverse) {
+      for (int e = 0; e < n * n; e++) {
+        std::memcpy(inverse + e * shape.padded + lane, x + e * kLanes,
+                    sizeof(Vector));
+      }
+    }
+    if (determinant) Store(determinant + lane, det);
+    std::memcpy(singular + lane, &is_singular, sizeof(is_singular));
+  }
+}
+
+typedef double Vector2 __attribute__((vector_size(2 * sizeof(double))));
+typedef double Vector4 __attribute__((vector_size(4 * sizeof(double))));
+typedef double Vector8 __attribute__((vector_size(8 * sizeof(double))));
+
+using MulFunction = void (*)(const BatchShape&, int, int, const double*,
+                             const double*, double*);
+using EliminateFunction = void (*)(const BatchShape&, int, int, const double*,
+                                   double*, double*, long*, double*);
+
+void MulGeneric(const BatchShape& shape, int begin, int end, const double* a,
+                const double* b, double* c) {
+  MulBody<Vector2>(shape, begin, end, a, b, c);
+}
+
+void EliminateGeneric(const BatchShape& shape, int begin, int end,
+                      const double* a, double* inverse, double* determinant,
+                      long* singular, double* work) {
+  EliminateBody<Vector2>(shape, begin, end, a, inverse, determinant, singular,
+                         work);
+}
+
+#ifdef S21_BATCH_HAVE_X86_KERNELS
+__attribute__((target("avx2,fma"))) void MulAvx2(const BatchShape& shape,
+                                                 int begin, int end,
+                                                 const double* a,
+                                                 const double* b, double* c) {
+  MulBody<Vector4>(shape, begin, end, a, b, c);
+}
+
+__attribute__((target("avx2,fma"))) void EliminateAvx2(
+    const BatchShape& shape, int begin, int end, const double* a,
+    double* inverse, double* determinant, long* singular, double* work) {
+  EliminateBody<Vector4>(shape, begin, end, a, inverse, determinant, singular,
+                         work);
+}
+
+__attribute__((target("avx512f"))) void MulAvx512(const BatchShape& shape,
+                                                  int begin, int end,
+                                                  const double* a,
+                                                  const double* b, double* c) {
+  MulBody<Vector8>(shape, begin, end, a, b, c);
+}
+
+__attribute__((target("avx512f"))) void EliminateAvx512(
+    const BatchShape& shape, int begin, int end, const double* a,
+    double* inverse, double* determinant, long* singular, double* work) {
+  EliminateBody<Vector8>(shape, begin, end, a, inverse, determinant, singular,
+                         work);
+}
+#endif
+
+MulFunction SelectMul() {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_BATCH_HAVE_X86_KERNELS
+    case S21SimdLevel::kAvx512:
+      return MulAvx512;
+    case S21SimdLevel::kAvx2:
+      return MulAvx2;
+#endif
+    default:
+      return MulGeneric;
+  }
+}
+
+EliminateFunction SelectEliminate() {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_BATCH_HAVE_X86_KERNELS
+    case S21SimdLevel::kAvx512:
+      return EliminateAvx512;
+    case S21SimdLevel::kAvx2:
+      return EliminateAvx2;
+#endif
+    default:
+      return EliminateGeneric;
+  }
+}
+
+// Splits [0, padded) into lane ranges that are multiples of `group` and runs
+// them on the global pool when the batch is large enough.
+template <typename Task>
+void ForLaneChunks(int count, int padded, int group, const Task& task) {
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int threads = pool.GetThreadCount();
+  if (threads <= 1 || count < kParallelCount) {
+    task(0, padded);
+    return;
+  }
+  int groups = padded / group;
+  int chunks = std::min(threads, groups);
+  int chunk_groups = (groups + chunks - 1) / chunks;
+  pool.ParallelFor(chunks, [&](int chunk) {
+    int begin = chunk * chunk_groups * group;
+    int end = std::min(padded, begin + chunk_groups * group);
+    if (begin < end) task(begin, end);
+  });
+}
+
+}  // namespace
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols)
+    : count_(count), rows_(rows), cols_(cols) {
+  if (count_ <= 0)
+    throw std::logic_error("The number of matrices must be positive");
+  if (cols_ <= 0 || rows_ <= 0)
+    throw std::logic_error(
+        "Numbers of rows and columns in a matrix must be positive");
+  padded_count_ = (count_ + kLaneGroup - 1) / kLaneGroup * kLaneGroup;
+  data_.assign(static_cast<std::size_t>(rows_) * cols_ * padded_count_, 0.0);
+}
+
+int S21MatrixBatch::GetCount() const noexcept { return count_; }
+
+int S21MatrixBatch::GetRows() const noexcept { return rows_; }
+
+int S21MatrixBatch::GetCols() const noexcept { return cols_; }
+
+double& S21MatrixBatch::operator()(int index, int row, int col) {
+  CheckIndexesAreInRange(index, row, col);
+  return ElementData(row, col)[index];
+}
+
+const double& S21MatrixBatch::operator()(int index, int row, int col) const {
+  CheckIndexesAreInRange(index, row, col);
+  return ElementData(row, col)[index];
+}
+
+S21Matrix S21MatrixBatch::GetMatrix(int index) const {
+  CheckIndexesAreInRange(index, 0, 0);
+  S21Matrix result(rows_, cols_);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) result(i, j) = ElementData(i, j)[index];
+  }
+  return result;
+}
+
+void S21MatrixBatch::SetMatrix(int index, const S21Matrix& matrix) {
+  CheckIndexesAreInRange(index, 0, 0);
+  if (matrix.GetRows() != rows_ || matrix.GetCols() != cols_)
+    throw std::logic_error("Matrices must have the same dimensions");
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) ElementData(i, j)[index] = matrix(i, j);
+  }
+}
+
+S21MatrixBatch S21MatrixBatch::BatchMul(const S21MatrixBatch& other) const {
+  if (count_ != other.count_)
+    throw std::logic_error("Batches must have the same number of matrices");
+  if (cols_ != other.rows_)
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+
+  S21MatrixBatch result(count_, rows_, other.cols_);
+  BatchShape shape{rows_, cols_, other.cols_, padded_count_};
+  MulFunction mul = SelectMul();
+  ForLaneChunks(count_, padded_count_, kLaneGroup, [&](int begin, int end) {
+    mul(shape, begin, end, data_.data(), other.data_.data(),
+        result.data_.data());
+  });
+  return result;
+}
+
+S21MatrixBatch S21MatrixBatch::BatchInverse() const {
+  CheckMatrixIsSquare();
+
+  S21MatrixBatch result(count_, rows_, cols_);
+  std::vector<long> singular(padded_count_);
+  BatchShape shape{rows_, rows_, rows_, padded_count_};
+  EliminateFunction eliminate = SelectEliminate();
+  ForLaneChunks(count_, padded_count_, kLaneGroup, [&](int begin, int end) {
+    std::vector<double> work(2 * rows_ * rows_ * kLaneGroup);
+    eliminate(shape, begin, end, data_.data(), result.data_.data(), nullptr,
+              singular.data(), work.data());
+  });
+
+  if (std::any_of(singular.begin(), singular.begin() + count_,
+                  [](long flag) { return flag != 0; }))
+    throw std::logic_error("The matrix is not invertible");
+  return result;
+}
+
+std::vector<double> S21MatrixBatch::BatchDeterminant() const {
+  CheckMatrixIsSquare();
+
+  std::vector<double> result(padded_count_);
+  std::vector<long> singular(padded_count_);
+  BatchShape shape{rows_, rows_, rows_, padded_count_};
+  EliminateFunction eliminate = SelectEliminate();
+  ForLaneChunks(count_, padded_count_, kLaneGroup, [&](int begin, int end) {
+    std::vector<double> work(2 * rows_ * rows_ * kLaneGroup);
+    eliminate(shape, begin, end, data_.data(), nullptr, result.data(),
+              singular.data(), work.data());
+  });
+  result.resize(count_);
+  return result;
+}
+
+void S21MatrixBatch::CheckIndexesAreInRange(int index, int row,
+                                            int col) const {
+  if (index >= count_ || index < 0 || row >= rows_ || row < 0 ||
+      col >= cols_ || col < 0)
+    throw std::out_of_range("Index is outside the matrix");
+}
+
+void S21MatrixBatch::CheckMatrixIsSquare() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix is not square");
+  }
+}
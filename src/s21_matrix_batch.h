@@ -0,0 +1,49 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_BATCH_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_BATCH_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Many matrices of one shape stored interleaved: element (row, col) of every
+// matrix in the batch is contiguous, so each kernel works on a whole SIMD
+// register of matrices at a time and never branches on individual matrices.
+class S21MatrixBatch {
+ public:
+  S21MatrixBatch(int count, int rows, int cols);
+
+  int GetCount() const noexcept;
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+
+  double& operator()(int index, int row, int col);
+  const double& operator()(int index, int row, int col) const;
+  S21Matrix GetMatrix(int index) const;
+  void SetMatrix(int index, const S21Matrix& matrix);
+
+  S21MatrixBatch BatchMul(const S21MatrixBatch& other) const;
+  S21MatrixBatch BatchInverse() const;
+  std::vector<double> BatchDeterminant() const;
+
+ private:
+  // Every kernel handles up to this many matrices per step.
+  static constexpr int kLaneGroup = 8;
+
+  void CheckIndexesAreInRange(int index, int row, int col) const;
+  void CheckMatrixIsSquare() const;
+  double* ElementData(int row, int col) noexcept {
+    return data_.data() +
+           static_cast<std::size_t>(row * cols_ + col) * padded_count_;
+  }
+  const double* ElementData(int row, int col) const noexcept {
+    return data_.data() +
+           static_cast<std::size_t>(row * cols_ + col) * padded_count_;
+  }
+
+  int count_, rows_, cols_;
+  int padded_count_;
+  std::vector<double> data_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_BATCH_H_
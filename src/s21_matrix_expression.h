@@ -0,0 +1,303 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_EXPRESSION_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_EXPRESSION_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_instrumentation.h"
+#include "s21_matrix_arena.h"
+#include "s21_matrix_oop.h"
+
+// Fusion is opt-in. Plain a + b, a - b and a * x of S21Matrix operands return
+// an S21Matrix computed with the SIMD kernels, one pass per operator; in a
+// chain, temporaries are updated in place rather than reallocated. Starting a
+// chain with Lazy(), as in result = a.Lazy() + b - c.Lazy() * 2.0, builds a
+// lightweight expression instead, which is evaluated in a single pass when it
+// is assigned to (or used to construct) an S21Matrix, applied with += / -=,
+// or passed to Eval(). Expressions refer to their operands' storage, so they
+// are meant to be consumed in the statement that builds them.
+template <typename E>
+class S21MatrixExpression {
+ public:
+  const E& Self() const noexcept { return static_cast<const E&>(*this); }
+  int GetRows() const noexcept { return Self().GetRows(); }
+  int GetCols() const noexcept { return Self().GetCols(); }
+  double Get(int row, int col) const noexcept { return Self().Get(row, col); }
+  S21Matrix Eval() const { return S21Matrix(*this); }
+};
+
+// kOperations is the number of floating-point operations per element.
+class S21MatrixTerm : public S21MatrixExpression<S21MatrixTerm> {
+ public:
+  static constexpr int kOperations = 0;
+
+  explicit S21MatrixTerm(const S21Matrix& matrix) noexcept
+      : rows_(matrix.rows_),
+        cols_(matrix.cols_),
+        stride_(matrix.stride_),
+        data_(matrix.matrix_) {}
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  double Get(int row, int col) const noexcept {
+    return data_[static_cast<std::ptrdiff_t>(row) * stride_ + col];
+  }
+
+ private:
+  int rows_, cols_;
+  std::ptrdiff_t stride_;
+  const double* data_;
+};
+
+struct S21PlusOperation {
+  static double Apply(double left, double right) noexcept {
+    return left + right;
+  }
+};
+
+struct S21MinusOperation {
+  static double Apply(double left, double right) noexcept {
+    return left - right;
+  }
+};
+
+template <typename L, typename R, typename Operation>
+class S21MatrixBinaryExpression
+    : public S21MatrixExpression<S21MatrixBinaryExpression<L, R, Operation>> {
+ public:
+  static constexpr int kOperations = L::kOperations + R::kOperations + 1;
+
+  S21MatrixBinaryExpression(const L& left, const R& right)
+      : left_(left), right_(right) {
+    if (left.GetRows() != right.GetRows() || left.GetCols() != right.GetCols())
+      throw std::logic_error("Matrices must have the same dimensions");
+  }
+
+  int GetRows() const noexcept { return left_.GetRows(); }
+  int GetCols() const noexcept { return left_.GetCols(); }
+  double Get(int row, int col) const noexcept {
+    return Operation::Apply(left_.Get(row, col), right_.Get(row, col));
+  }
+
+ private:
+  L left_;
+  R right_;
+};
+
+template <typename E>
+class S21MatrixScaledExpression
+    : public S21MatrixExpression<S21MatrixScaledExpression<E>> {
+ public:
+  static constexpr int kOperations = E::kOperations + 1;
+
+  S21MatrixScaledExpression(const E& expression, double factor) noexcept
+      : expression_(expression), factor_(factor) {}
+
+  int GetRows() const noexcept { return expression_.GetRows(); }
+  int GetCols() const noexcept { return expression_.GetCols(); }
+  double Get(int row, int col) const noexcept {
+    return expression_.Get(row, col) * factor_;
+  }
+
+ private:
+  E expression_;
+  double factor_;
+};
+
+template <typename T>
+constexpr bool kS21IsMatrixExpression =
+    std::is_base_of<S21MatrixExpression<T>, T>::value;
+
+template <typename T, typename = void>
+struct S21ExpressionTraits {};
+
+template <>
+struct S21ExpressionTraits<S21Matrix> {
+  using Type = S21MatrixTerm;
+  static Type Wrap(const S21Matrix& matrix) noexcept {
+    return S21MatrixTerm(matrix);
+  }
+};
+
+template <typename T>
+struct S21ExpressionTraits<
+    T, std::enable_if_t<kS21IsMatrixExpression<T>>> {
+  using Type = T;
+  static const T& Wrap(const T& expression) noexcept { return expression; }
+};
+
+// Lazy operators apply once either operand is already an expression.
+template <typename L, typename R>
+using S21EnableIfLazy =
+    std::enable_if_t<kS21IsMatrixExpression<L> || kS21IsMatrixExpression<R>>;
+
+template <typename L, typename R>
+using S21MatrixSum =
+    S21MatrixBinaryExpression<typename S21ExpressionTraits<L>::Type,
+                              typename S21ExpressionTraits<R>::Type,
+                              S21PlusOperation>;
+
+template <typename L, typename R>
+using S21MatrixDifference =
+    S21MatrixBinaryExpression<typename S21ExpressionTraits<L>::Type,
+                              typename S21ExpressionTraits<R>::Type,
+                              S21MinusOperation>;
+
+template <typename E>
+using S21MatrixScaled =
+    S21MatrixScaledExpression<typename S21ExpressionTraits<E>::Type>;
+
+inline S21MatrixTerm S21Matrix::Lazy() const noexcept {
+  return S21MatrixTerm(*this);
+}
+
+template <typename L, typename R, typename = S21EnableIfLazy<L, R>>
+S21MatrixSum<L, R> operator+(const L& left, const R& right) {
+  return S21MatrixSum<L, R>(S21ExpressionTraits<L>::Wrap(left),
+                            S21ExpressionTraits<R>::Wrap(right));
+}
+
+template <typename L, typename R, typename = S21EnableIfLazy<L, R>>
+S21MatrixDifference<L, R> operator-(const L& left, const R& right) {
+  return S21MatrixDifference<L, R>(S21ExpressionTraits<L>::Wrap(left),
+                                   S21ExpressionTraits<R>::Wrap(right));
+}
+
+template <typename E, typename = S21EnableIfLazy<E, E>>
+S21MatrixScaled<E> operator*(const E& expression, double num) {
+  return S21MatrixScaled<E>(S21ExpressionTraits<E>::Wrap(expression), num);
+}
+
+template <typename E, typename = S21EnableIfLazy<E, E>>
+S21MatrixScaled<E> operator*(double num, const E& expression) {
+  return S21MatrixScaled<E>(S21ExpressionTraits<E>::Wrap(expression), num);
+}
+
+// A temporary S21Matrix operand is about to be destroyed, so its buffer is
+// reused for the result. This also keeps a lazy chain from referring to a
+// temporary after the full-expression ends.
+template <typename R, typename = typename S21ExpressionTraits<R>::Type>
+S21Matrix operator+(S21Matrix&& left, const R& right) {
+  left += right;
+  return std::move(left);
+}
+
+template <typename L, typename = typename S21ExpressionTraits<L>::Type>
+S21Matrix operator+(const L& left, S21Matrix&& right) {
+  right += left;
+  return std::move(right);
+}
+
+inline S21Matrix operator+(S21Matrix&& left, S21Matrix&& right) {
+  left += right;
+  return std::move(left);
+}
+
+template <typename R, typename = typename S21ExpressionTraits<R>::Type>
+S21Matrix operator-(S21Matrix&& left, const R& right) {
+  left -= right;
+  return std::move(left);
+}
+
+template <typename L, typename = typename S21ExpressionTraits<L>::Type>
+S21Matrix operator-(const L& left, S21Matrix&& right) {
+  right = S21MatrixDifference<L, S21Matrix>(S21ExpressionTraits<L>::Wrap(left),
+                                            S21MatrixTerm(right));
+  return std::move(right);
+}
+
+inline S21Matrix operator-(S21Matrix&& left, S21Matrix&& right) {
+  left -= right;
+  return std::move(left);
+}
+
+inline S21Matrix operator*(S21Matrix&& matrix, double num) {
+  matrix *= num;
+  return std::move(matrix);
+}
+
+inline S21Matrix operator*(double num, S21Matrix&& matrix) {
+  matrix *= num;
+  return std::move(matrix);
+}
+
+template <typename L>
+S21Matrix operator*(const S21MatrixExpression<L>& left,
+                    const S21Matrix& right) {
+  return S21Matrix(left) * right;
+}
+
+template <typename L, typename R>
+S21Matrix operator*(const S21MatrixExpression<L>& left,
+                    const S21MatrixExpression<R>& right) {
+  return S21Matrix(left) * S21Matrix(right);
+}
+
+template <typename E>
+double S21ExpressionFlops(const S21MatrixExpression<E>& expression,
+                          int accumulate) {
+  return static_cast<double>(expression.GetRows()) * expression.GetCols() *
+         (E::kOperations + accumulate);
+}
+
+template <typename E>
+S21Matrix::S21Matrix(const S21MatrixExpression<E>& expression)
+    : rows_(expression.GetRows()),
+      cols_(expression.GetCols()),
+      stride_(cols_),
+      capacity_(rows_),
+      arena_(S21MatrixArena::Current()),
+      matrix_(nullptr) {
+  S21_INSTRUMENT_OPERATION(kExpression, S21ExpressionFlops(expression, 0));
+  matrix_ = AllocateBuffer(static_cast<std::size_t>(rows_) * cols_, arena_);
+  AssignExpression(expression.Self(), S21PlusOperation(), false);
+}
+
+template <typename E>
+S21Matrix& S21Matrix::operator=(const S21MatrixExpression<E>& expression) {
+  S21_INSTRUMENT_OPERATION(kExpression, S21ExpressionFlops(expression, 0));
+  int rows = expression.GetRows(), cols = expression.GetCols();
+  if (rows_ == rows && cols_ == cols) {
+    AssignExpression(expression.Self(), S21PlusOperation(), false);
+  } else {
+    S21Matrix result(rows, cols, rows, cols, arena_);
+    result.AssignExpression(expression.Self(), S21PlusOperation(), false);
+    Swap(result);
+  }
+  return *this;
+}
+
+template <typename E>
+S21Matrix& S21Matrix::operator+=(const S21MatrixExpression<E>& expression) {
+  S21_INSTRUMENT_OPERATION(kExpression, S21ExpressionFlops(expression, 1));
+  CheckMatrixHasDimensions(expression.GetRows(), expression.GetCols());
+  AssignExpression(expression.Self(), S21PlusOperation(), true);
+  return *this;
+}
+
+template <typename E>
+S21Matrix& S21Matrix::operator-=(const S21MatrixExpression<E>& expression) {
+  S21_INSTRUMENT_OPERATION(kExpression, S21ExpressionFlops(expression, 1));
+  CheckMatrixHasDimensions(expression.GetRows(), expression.GetCols());
+  AssignExpression(expression.Self(), S21MinusOperation(), true);
+  return *this;
+}
+
+template <typename E, typename Operation>
+void S21Matrix::AssignExpression(const E& expression, Operation,
+                                 bool accumulate) {
+  for (int i = 0; i < rows_; i++) {
+    double* row = RowData(i);
+    if (accumulate) {
+      for (int j = 0; j < cols_; j++) {
+        row[j] = Operation::Apply(row[j], expression.Get(i, j));
+      }
+    } else {
+      for (int j = 0; j < cols_; j++) row[j] = expression.Get(i, j);
+    }
+  }
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_EXPRESSION_H_
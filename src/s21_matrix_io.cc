@@ -0,0 +1,368 @@
+#include "s21_matrix_io.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Narrow or strided matrices are staged through a buffer of this many bytes
+// so that I/O is not issued one row at a time.
+constexpr std::size_t kStagingBytes = 1 << 20;
+
+class FileDescriptor {
+ public:
+  explicit FileDescriptor(int descriptor) : descriptor_(descriptor) {}
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+  ~FileDescriptor() {
+    if (descriptor_ >= 0) close(descriptor_);
+  }
+
+  int Get() const noexcept { return descriptor_; }
+  void Release() noexcept { descriptor_ = -1; }
+
+ private:
+  int descriptor_;
+};
+
+void ReadFully(int descriptor, void* buffer, std::size_t size,
+               std::uint64_t offset) {
+  char* position = static_cast<char*>(buffer);
+  while (size > 0) {
+    ssize_t count = pread(descriptor, position, size, offset);
+    if (count <= 0) throw std::runtime_error("The matrix file is truncated");
+    position += count;
+    size -= count;
+    offset += count;
+  }
+}
+
+void WriteFully(int descriptor, const void* buffer, std::size_t size,
+                std::uint64_t offset) {
+  const char* position = static_cast<const char*>(buffer);
+  while (size > 0) {
+    ssize_t count = pwrite(descriptor, position, size, offset);
+    if (count <= 0) throw std::runtime_error("Cannot write the matrix file");
+    position += count;
+    size -= count;
+    offset += count;
+  }
+}
+
+std::uint64_t FileSize(int descriptor) {
+  struct stat status;
+  if (fstat(descriptor, &status) != 0)
+    throw std::runtime_error("Cannot open the matrix file");
+  return static_cast<std::uint64_t>(status.st_size);
+}
+
+int RowsPerStage(int cols) {
+  return static_cast<int>(
+      std::max<std::size_t>(1, kStagingBytes / (cols * sizeof(double))));
+}
+
+S21MatrixFileHeader MakeHeader(int rows, int cols) {
+  S21MatrixFileHeader header = {};
+  std::memcpy(header.magic, S21MatrixFileHeader::kMagic, sizeof(header.magic));
+  header.version = S21MatrixFileHeader::kVersion;
+  header.byte_order = S21MatrixFileHeader::kByteOrder;
+  header.element_type = S21MatrixFileHeader::kFloat64;
+  header.element_size = sizeof(double);
+  header.data_offset = sizeof(header);
+  header.rows = rows;
+  header.cols = cols;
+  return header;
+}
+
+}  // namespace
+
+void S21SaveMatrix(const S21ConstMatrixView& matrix, const std::string& path) {
+  FileDescriptor file(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+  if (file.Get() < 0) throw std::runtime_error("Cannot open the matrix file");
+
+  S21MatrixFileHeader header = MakeHeader(matrix.GetRows(), matrix.GetCols());
+  WriteFully(file.Get(), &header, sizeof(header), 0);
+
+  int rows = matrix.GetRows(), cols = matrix.GetCols();
+  std::size_t row_bytes = cols * sizeof(double);
+  std::uint64_t offset = header.data_offset;
+  if (matrix.GetColStride() == 1 && matrix.GetRowStride() == cols) {
+    WriteFully(file.Get(), matrix.Data(), rows * row_bytes, offset);
+    return;
+  }
+
+  int stage_rows = std::min(rows, RowsPerStage(cols));
+  std::vector<double> stage(static_cast<std::size_t>(stage_rows) * cols);
+  for (int first = 0; first < rows; first += stage_rows) {
+    int count = std::min(stage_rows, rows - first);
+    for (int i = 0; i < count; i++) {
+      for (int j = 0; j < cols; j++) {
+        stage[static_cast<std::size_t>(i) * cols + j] = matrix(first + i, j);
+      }
+    }
+    WriteFully(file.Get(), stage.data(), count * row_bytes, offset);
+    offset += count * row_bytes;
+  }
+}
+
+S21MatrixFileHeader S21ReadMatrixHeader(int descriptor,
+                                        std::uint64_t file_size) {
+  S21MatrixFileHeader header;
+  if (file_size < sizeof(header))
+    throw std::runtime_error("The file is not a matrix file");
+  ReadFully(descriptor, &header, sizeof(header), 0);
+  if (std::memcmp(header.magic, S21MatrixFileHeader::kMagic,
+                  sizeof(header.magic)) != 0)
+    throw std::runtime_error("The file is not a matrix file");
+  if (header.version != S21MatrixFileHeader::kVersion ||
+      header.byte_order != S21MatrixFileHeader::kByteOrder ||
+      header.element_type != S21MatrixFileHeader::kFloat64 ||
+      header.element_size != sizeof(double) ||
+      header.data_offset < sizeof(header) || header.data_offset % 64 != 0)
+    throw std::runtime_error("The matrix file format is not supported");
+  if (header.rows <= 0 || header.cols <= 0 || header.rows > INT_MAX ||
+      header.cols > INT_MAX)
+    throw std::runtime_error(
+        "Numbers of rows and columns in a matrix must be positive");
+  if (header.data_offset > file_size ||
+      static_cast<std::uint64_t>(header.rows) >
+          (file_size - header.data_offset) / sizeof(double) / header.cols)
+    throw std::runtime_error("The matrix file is truncated");
+  return header;
+}
+
+void S21Matrix::Save(const std::string& path) const {
+  S21SaveMatrix(*this, path);
+}
+
+S21Matrix S21Matrix::Load(const std::string& path) {
+  FileDescriptor file(open(path.c_str(), O_RDONLY));
+  if (file.Get() < 0) throw std::runtime_error("Cannot open the matrix file");
+  S21MatrixFileHeader header =
+      S21ReadMatrixHeader(file.Get(), FileSize(file.Get()));
+
+  S21Matrix result(static_cast<int>(header.rows),
+                   static_cast<int>(header.cols));
+  std::size_t row_bytes = result.cols_ * sizeof(double);
+  std::uint64_t offset = header.data_offset;
+  if (result.IsContiguous()) {
+    ReadFully(file.Get(), result.matrix_, result.rows_ * row_bytes, offset);
+    return result;
+  }
+
+  int stage_rows = std::min(result.rows_, RowsPerStage(result.cols_));
+  std::vector<double> stage(static_cast<std::size_t>(stage_rows) *
+                            result.cols_);
+  for (int first = 0; first < result.rows_; first += stage_rows) {
+    int count = std::min(stage_rows, result.rows_ - first);
+    ReadFully(file.Get(), stage.data(), count * row_bytes, offset);
+    offset += count * row_bytes;
+    for (int i = 0; i < count; i++) {
+      std::memcpy(result.RowData(first + i),
+                  stage.data() + static_cast<std::size_t>(i) * result.cols_,
+                  row_bytes);
+    }
+  }
+  return result;
+}
+
+S21MappedMatrix::S21MappedMatrix(const std::string& path)
+    : mapping_(nullptr), mapping_size_(0), rows_(0), cols_(0), data_(nullptr) {
+  FileDescriptor file(open(path.c_str(), O_RDONLY));
+  if (file.Get() < 0) throw std::runtime_error("Cannot open the matrix file");
+  std::uint64_t file_size = FileSize(file.Get());
+  S21MatrixFileHeader header = S21ReadMatrixHeader(file.Get(), file_size);
+
+  void* mapping =
+      mmap(nullptr, file_size, PROT_READ, MAP_SHARED, file.Get(), 0);
+  if (mapping == MAP_FAILED)
+    throw std::runtime_error("Cannot map the matrix file");
+  mapping_ = mapping;
+  mapping_size_ = file_size;
+  rows_ = static_cast<int>(header.rows);
+  cols_ = static_cast<int>(header.cols);
+  data_ = reinterpret_cast<const double*>(static_cast<const char*>(mapping) +
+                                          header.data_offset);
+}
+
+S21MappedMatrix::S21MappedMatrix(S21MappedMatrix&& other) noexcept
+    : mapping_(other.mapping_),
+      mapping_size_(other.mapping_size_),
+      rows_(other.rows_),
+      cols_(other.cols_),
+      data_(other.data_) {
+  other.mapping_ = nullptr;
+  other.mapping_size_ = 0;
+  other.rows_ = other.cols_ = 0;
+  other.data_ = nullptr;
+}
+
+S21MappedMatrix& S21MappedMatrix::operator=(S21MappedMatrix&& other) noexcept {
+  if (this != &other) {
+    Unmap();
+    std::swap(mapping_, other.mapping_);
+    std::swap(mapping_size_, other.mapping_size_);
+    std::swap(rows_, other.rows_);
+    std::swap(cols_, other.cols_);
+    std::swap(data_, other.data_);
+  }
+  return *this;
+}
+
+S21MappedMatrix::~S21MappedMatrix() { Unmap(); }
+
+const double& S21MappedMatrix::operator()(int row, int col) const {
+  if (row >= rows_ || row < 0 || col >= cols_ || col < 0)
+    throw std::out_of_range("Index is outside the matrix");
+  return data_[static_cast<std::size_t>(row) * cols_ + col];
+}
+
+S21ConstMatrixView S21MappedMatrix::View() const noexcept {
+  return S21ConstMatrixView(data_, rows_, cols_, cols_, 1);
+}
+
+S21Matrix S21MappedMatrix::ToMatrix() const { return S21Matrix(View()); }
+
+void S21MappedMatrix::Unmap() noexcept {
+  if (mapping_) munmap(mapping_, mapping_size_);
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  rows_ = cols_ = 0;
+  data_ = nullptr;
+}
+
+S21FileMatrix::S21FileMatrix(const std::string& path)
+    : descriptor_(-1), path_(path), rows_(0), cols_(0), data_offset_(0) {
+  int descriptor = open(path.c_str(), O_RDWR);
+  if (descriptor < 0) descriptor = open(path.c_str(), O_RDONLY);
+  FileDescriptor file(descriptor);
+  if (file.Get() < 0) throw std::runtime_error("Cannot open the matrix file");
+  S21MatrixFileHeader header =
+      S21ReadMatrixHeader(file.Get(), FileSize(file.Get()));
+  rows_ = static_cast<int>(header.rows);
+  cols_ = static_cast<int>(header.cols);
+  data_offset_ = header.data_offset;
+  descriptor_ = file.Get();
+  file.Release();
+}
+
+S21FileMatrix S21FileMatrix::Create(const std::string& path, int rows,
+                                    int cols) {
+  if (cols <= 0 || rows <= 0)
+    throw std::logic_error(
+        "Numbers of rows and columns in a matrix must be positive");
+  FileDescriptor file(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+  if (file.Get() < 0) throw std::runtime_error("Cannot open the matrix file");
+  S21MatrixFileHeader header = MakeHeader(rows, cols);
+  WriteFully(file.Get(), &header, sizeof(header), 0);
+  std::uint64_t size = header.data_offset + static_cast<std::uint64_t>(rows) *
+                                                cols * sizeof(double);
+  if (ftruncate(file.Get(), static_cast<off_t>(size)) != 0)
+    throw std::runtime_error("Cannot write the matrix file");
+  S21FileMatrix result(file.Get(), path, header);
+  file.Release();
+  return result;
+}
+
+bool S21FileMatrix::IsStoredAt(const std::string& path) const {
+  struct stat own, other;
+  if (fstat(descriptor_, &own) != 0 || stat(path.c_str(), &other) != 0)
+    return false;
+  return own.st_dev == other.st_dev && own.st_ino == other.st_ino;
+}
+
+S21FileMatrix::S21FileMatrix(int descriptor, const std::string& path,
+                             const S21MatrixFileHeader& header) noexcept
+    : descriptor_(descriptor),
+      path_(path),
+      rows_(static_cast<int>(header.rows)),
+      cols_(static_cast<int>(header.cols)),
+      data_offset_(header.data_offset) {}
+
+S21FileMatrix::S21FileMatrix(S21FileMatrix&& other) noexcept
+    : descriptor_(other.descriptor_),
+      path_(std::move(other.path_)),
+      rows_(other.rows_),
+      cols_(other.cols_),
+      data_offset_(other.data_offset_) {
+  other.descriptor_ = -1;
+  other.rows_ = other.cols_ = 0;
+}
+
+S21FileMatrix& S21FileMatrix::operator=(S21FileMatrix&& other) noexcept {
+  if (this != &other) {
+    Close();
+    std::swap(descriptor_, other.descriptor_);
+    std::swap(path_, other.path_);
+    std::swap(rows_, other.rows_);
+    std::swap(cols_, other.cols_);
+    std::swap(data_offset_, other.data_offset_);
+  }
+  return *this;
+}
+
+S21FileMatrix::~S21FileMatrix() { Close(); }
+
+void S21FileMatrix::ReadBlock(int row, int col, S21MatrixView block) const {
+  int rows = block.GetRows(), cols = block.GetCols();
+  CheckBlockIsInRange(row, col, rows, cols);
+  std::size_t row_bytes = cols * sizeof(double);
+  if (block.GetColStride() == 1 && block.GetRowStride() == cols &&
+      cols == cols_) {
+    ReadFully(descriptor_, block.Data(), rows * row_bytes, Offset(row, col));
+    return;
+  }
+
+  std::vector<double> stage(block.GetColStride() == 1 ? 0 : cols);
+  for (int i = 0; i < rows; i++) {
+    double* target = block.Data() + i * block.GetRowStride();
+    if (stage.empty()) {
+      ReadFully(descriptor_, target, row_bytes, Offset(row + i, col));
+    } else {
+      ReadFully(descriptor_, stage.data(), row_bytes, Offset(row + i, col));
+      for (int j = 0; j < cols; j++) block(i, j) = stage[j];
+    }
+  }
+}
+
+void S21FileMatrix::WriteBlock(int row, int col,
+                               const S21ConstMatrixView& block) {
+  int rows = block.GetRows(), cols = block.GetCols();
+  CheckBlockIsInRange(row, col, rows, cols);
+  std::size_t row_bytes = cols * sizeof(double);
+  if (block.GetColStride() == 1 && block.GetRowStride() == cols &&
+      cols == cols_) {
+    WriteFully(descriptor_, block.Data(), rows * row_bytes, Offset(row, col));
+    return;
+  }
+
+  std::vector<double> stage(block.GetColStride() == 1 ? 0 : cols);
+  for (int i = 0; i < rows; i++) {
+    const double* source = block.Data() + i * block.GetRowStride();
+    if (!stage.empty()) {
+      for (int j = 0; j < cols; j++) stage[j] = block(i, j);
+      source = stage.data();
+    }
+    WriteFully(descriptor_, source, row_bytes, Offset(row + i, col));
+  }
+}
+
+void S21FileMatrix::CheckBlockIsInRange(int row, int col, int rows,
+                                        int cols) const {
+  if (row < 0 || col < 0 || rows > rows_ - row || cols > cols_ - col)
+    throw std::out_of_range("Block is outside the matrix");
+}
+
+void S21FileMatrix::Close() noexcept {
+  if (descriptor_ >= 0) close(descriptor_);
+  descriptor_ = -1;
+}
@@ -0,0 +1,105 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_IO_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_IO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "s21_matrix_oop.h"
+
+// Binary matrix file: a 64-byte header followed by the elements as native
+// doubles in row-major order. The elements start at data_offset, a multiple
+// of 64, so a mapped file keeps them cache-line aligned.
+struct S21MatrixFileHeader {
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'T', 'R', 'X', '\0'};
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint32_t kByteOrder = 0x01020304;
+  static constexpr std::uint32_t kFloat64 = 1;
+
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t element_type;
+  std::uint32_t element_size;
+  std::uint64_t data_offset;
+  std::int64_t rows;
+  std::int64_t cols;
+  char reserved[16];
+};
+static_assert(sizeof(S21MatrixFileHeader) == 64,
+              "The matrix file header must take 64 bytes");
+
+void S21SaveMatrix(const S21ConstMatrixView& matrix, const std::string& path);
+// Reads and validates the header of a matrix file whose size is file_size.
+S21MatrixFileHeader S21ReadMatrixHeader(int descriptor,
+                                        std::uint64_t file_size);
+
+// A read-only matrix backed directly by a memory-mapped matrix file. Opening
+// reads only the header; pages are loaded by the OS as elements are touched.
+class S21MappedMatrix {
+ public:
+  explicit S21MappedMatrix(const std::string& path);
+  S21MappedMatrix(const S21MappedMatrix&) = delete;
+  S21MappedMatrix(S21MappedMatrix&& other) noexcept;
+  S21MappedMatrix& operator=(const S21MappedMatrix&) = delete;
+  S21MappedMatrix& operator=(S21MappedMatrix&& other) noexcept;
+  ~S21MappedMatrix();
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  const double* Data() const noexcept { return data_; }
+  const double& operator()(int row, int col) const;
+  S21ConstMatrixView View() const noexcept;
+  S21Matrix ToMatrix() const;
+
+ private:
+  void Unmap() noexcept;
+
+  void* mapping_;
+  std::size_t mapping_size_;
+  int rows_, cols_;
+  const double* data_;
+};
+
+// A matrix file accessed block by block with positioned reads and writes,
+// for matrices too large to hold in memory.
+class S21FileMatrix {
+ public:
+  // Opens an existing matrix file, for writing too when permitted.
+  explicit S21FileMatrix(const std::string& path);
+  // Creates a zero-filled matrix file, replacing any existing one.
+  static S21FileMatrix Create(const std::string& path, int rows, int cols);
+  S21FileMatrix(const S21FileMatrix&) = delete;
+  S21FileMatrix(S21FileMatrix&& other) noexcept;
+  S21FileMatrix& operator=(const S21FileMatrix&) = delete;
+  S21FileMatrix& operator=(S21FileMatrix&& other) noexcept;
+  ~S21FileMatrix();
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  const std::string& GetPath() const noexcept { return path_; }
+  // Whether path names the file this matrix is stored in, through any link.
+  bool IsStoredAt(const std::string& path) const;
+
+  // Fill `block` with, or store it as, the block whose top-left element is
+  // at (row, col) and whose dimensions are those of `block`.
+  void ReadBlock(int row, int col, S21MatrixView block) const;
+  void WriteBlock(int row, int col, const S21ConstMatrixView& block);
+
+ private:
+  S21FileMatrix(int descriptor, const std::string& path,
+                const S21MatrixFileHeader& header) noexcept;
+  void CheckBlockIsInRange(int row, int col, int rows, int cols) const;
+  std::uint64_t Offset(int row, int col) const noexcept {
+    return data_offset_ +
+           (static_cast<std::uint64_t>(row) * cols_ + col) * sizeof(double);
+  }
+  void Close() noexcept;
+
+  int descriptor_;
+  std::string path_;
+  int rows_, cols_;
+  std::uint64_t data_offset_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_IO_H_
@@ -0,0 +1,167 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ITERATOR_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// The elements of one matrix row, with the interface of C++20's std::span.
+// Its iterators are plain pointers, so loops and algorithms over a row
+// vectorize.
+template <typename T>
+class S21Span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using iterator = T*;
+
+  constexpr S21Span() noexcept : data_(nullptr), size_(0) {}
+  constexpr S21Span(T* data, std::size_t size) noexcept
+      : data_(data), size_(size) {}
+  template <typename U,
+            typename = std::enable_if_t<std::is_same_v<const U, T>>>
+  constexpr S21Span(const S21Span<U>& other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr T* data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr T* begin() const noexcept { return data_; }
+  constexpr T* end() const noexcept { return data_ + size_; }
+  constexpr T& operator[](std::size_t index) const noexcept {
+    return data_[index];
+  }
+
+ private:
+  T* data_;
+  std::size_t size_;
+};
+
+// A random-access iterator over the elements of a matrix in row-major order.
+// Rows may be padded (stride > cols); the iterator steps over the padding at
+// the end of each row, which costs a compare per increment. Use the row
+// spans or the raw data when the loop has to vectorize.
+template <typename T>
+class S21MatrixIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  constexpr S21MatrixIterator() noexcept
+      : row_(nullptr), col_(0), cols_(1), stride_(1) {}
+  constexpr S21MatrixIterator(T* row, int col, int cols,
+                              std::ptrdiff_t stride) noexcept
+      : row_(row), col_(col), cols_(cols), stride_(stride) {}
+  template <typename U,
+            typename = std::enable_if_t<std::is_same_v<const U, T>>>
+  constexpr S21MatrixIterator(const S21MatrixIterator<U>& other) noexcept
+      : row_(other.row_),
+        col_(other.col_),
+        cols_(other.cols_),
+        stride_(other.stride_) {}
+
+  constexpr reference operator*() const noexcept { return row_[col_]; }
+  constexpr pointer operator->() const noexcept { return row_ + col_; }
+  constexpr reference operator[](difference_type offset) const noexcept {
+    return *(*this + offset);
+  }
+
+  constexpr S21MatrixIterator& operator++() noexcept {
+    if (++col_ == cols_) {
+      col_ = 0;
+      row_ += stride_;
+    }
+    return *this;
+  }
+  constexpr S21MatrixIterator operator++(int) noexcept {
+    S21MatrixIterator result = *this;
+    ++*this;
+    return result;
+  }
+  constexpr S21MatrixIterator& operator--() noexcept {
+    if (col_-- == 0) {
+      col_ = cols_ - 1;
+      row_ -= stride_;
+    }
+    return *this;
+  }
+  constexpr S21MatrixIterator operator--(int) noexcept {
+    S21MatrixIterator result = *this;
+    --*this;
+    return result;
+  }
+  constexpr S21MatrixIterator& operator+=(difference_type offset) noexcept {
+    difference_type index = col_ + offset;
+    if (index >= 0 && index < cols_) {
+      col_ = static_cast<int>(index);
+      return *this;
+    }
+    difference_type rows = index / cols_;
+    if (index % cols_ < 0) rows--;
+    row_ += rows * stride_;
+    col_ = static_cast<int>(index - rows * cols_);
+    return *this;
+  }
+  constexpr S21MatrixIterator& operator-=(difference_type offset) noexcept {
+    return *this += -offset;
+  }
+
+  friend constexpr S21MatrixIterator operator+(
+      S21MatrixIterator iterator, difference_type offset) noexcept {
+    return iterator += offset;
+  }
+  friend constexpr S21MatrixIterator operator+(
+      difference_type offset, S21MatrixIterator iterator) noexcept {
+    return iterator += offset;
+  }
+  friend constexpr S21MatrixIterator operator-(
+      S21MatrixIterator iterator, difference_type offset) noexcept {
+    return iterator -= offset;
+  }
+  friend constexpr difference_type operator-(
+      const S21MatrixIterator& left, const S21MatrixIterator& right) noexcept {
+    return (left.row_ - right.row_) / left.stride_ * left.cols_ +
+           (left.col_ - right.col_);
+  }
+
+  friend constexpr bool operator==(const S21MatrixIterator& left,
+                                   const S21MatrixIterator& right) noexcept {
+    return left.row_ == right.row_ && left.col_ == right.col_;
+  }
+  friend constexpr bool operator!=(const S21MatrixIterator& left,
+                                   const S21MatrixIterator& right) noexcept {
+    return !(left == right);
+  }
+  friend constexpr bool operator<(const S21MatrixIterator& left,
+                                  const S21MatrixIterator& right) noexcept {
+    return left.row_ < right.row_ ||
+           (left.row_ == right.row_ && left.col_ < right.col_);
+  }
+  friend constexpr bool operator>(const S21MatrixIterator& left,
+                                  const S21MatrixIterator& right) noexcept {
+    return right < left;
+  }
+  friend constexpr bool operator<=(const S21MatrixIterator& left,
+                                   const S21MatrixIterator& right) noexcept {
+    return !(right < left);
+  }
+  friend constexpr bool operator>=(const S21MatrixIterator& left,
+                                   const S21MatrixIterator& right) noexcept {
+    return !(left < right);
+  }
+
+ private:
+  template <typename>
+  friend class S21MatrixIterator;
+
+  T* row_;
+  int col_;
+  int cols_;
+  std::ptrdiff_t stride_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_ITERATOR_H_
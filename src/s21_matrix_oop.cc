@@ -1,24 +1,101 @@
 #include "s21_matrix_oop.h"
 
-S21Matrix::S21Matrix() : rows_(3), cols_(3) { CreateMatrix(); }
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "s21_decomposition.h"
+#include "s21_gemm.h"
+#include "s21_instrumentation.h"
+#include "s21_matrix_arena.h"
+#include "s21_simd.h"
+
+namespace {
+
+[[maybe_unused]] double RhsCols(const std::vector<S21Matrix>& rhs) {
+  double cols = 0;
+  for (const S21Matrix& matrix : rhs) cols += matrix.GetCols();
+  return cols;
+}
+
+// Calls kernel(row, other_row, size) for rows [begin, end) of two row-major
+// buffers, as a single span when neither has padding.
+template <typename Data, typename OtherData, typename Kernel>
+void ForRowSpans(int begin, int end, int cols, Data* data,
+                 std::ptrdiff_t stride, OtherData* other,
+                 std::ptrdiff_t other_stride, Kernel kernel) {
+  if (stride == cols && other_stride == cols) {
+    kernel(data + begin * stride, other + begin * other_stride,
+           static_cast<std::size_t>(end - begin) * cols);
+    return;
+  }
+  for (int i = begin; i < end; i++) {
+    kernel(data + i * stride, other + i * other_stride, cols);
+  }
+}
+
+}  // namespace
+
+S21Matrix::S21Matrix() : rows_(3), cols_(3), stride_(3), capacity_(3) {
+  CreateMatrix();
+}
 
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+S21Matrix::S21Matrix(int rows, int cols)
+    : rows_(rows), cols_(cols), stride_(cols), capacity_(rows) {
   CheckRowsAndColsArePositive();
   CreateMatrix();
 }
 
+// Leaves the buffer uninitialized.
+S21Matrix::S21Matrix(int rows, int cols, int capacity, int stride,
+                     S21MatrixArena* arena)
+    : rows_(rows),
+      cols_(cols),
+      stride_(stride),
+      capacity_(capacity),
+      arena_(arena),
+      matrix_(AllocateBuffer(static_cast<std::size_t>(capacity) * stride,
+                             arena_)) {}
+
 S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_), cols_(other.cols_) {
-  CreateMatrix();
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
-  }
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.cols_),
+      capacity_(other.rows_),
+      arena_(S21MatrixArena::Current()),
+      matrix_(nullptr) {
+  S21_INSTRUMENT_OPERATION(kCopy, 0);
+  matrix_ = AllocateBuffer(static_cast<std::size_t>(rows_) * cols_, arena_);
+  CopyMatrixValues(other);
+}
+
+S21Matrix::S21Matrix(const S21ExecutionPolicy& policy, const S21Matrix& other)
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.cols_),
+      capacity_(other.rows_),
+      arena_(S21MatrixArena::Current()),
+      matrix_(nullptr) {
+  S21_INSTRUMENT_OPERATION(kCopy, 0);
+  matrix_ = AllocateBuffer(static_cast<std::size_t>(rows_) * cols_, arena_);
+  CopyMatrixValues(policy, other);
+}
+
+S21Matrix::S21Matrix(const S21ConstMatrixView& view)
+    : S21Matrix(view.GetRows(), view.GetCols()) {
+  S21MatrixView(*this).Assign(view);
 }
 
 S21Matrix::S21Matrix(S21Matrix&& other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      capacity_(other.capacity_),
+      arena_(other.arena_),
+      matrix_(other.matrix_) {
   other.ResetData();
 }
 
@@ -31,36 +108,65 @@ void S21Matrix::CheckRowsAndColsArePositive() const {
 }
 
 void S21Matrix::CreateMatrix() {
-  matrix_ = new double*[rows_]();
-  for (int i = 0; i < rows_; i++) {
-    matrix_[i] = new double[cols_]();
-  }
+  std::size_t size = static_cast<std::size_t>(capacity_) * stride_;
+  arena_ = S21MatrixArena::Current();
+  matrix_ = AllocateBuffer(size, arena_);
+  std::fill(matrix_, matrix_ + size, 0.0);
 }
 
-void S21Matrix::DeleteMatrix() {
-  if (matrix_) {
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
+void S21Matrix::DeleteMatrix() { FreeBuffer(matrix_, arena_); }
+
+double* S21Matrix::AllocateBuffer(std::size_t size, S21MatrixArena* arena) {
+  S21_INSTRUMENT_ALLOCATION(size * sizeof(double));
+  if (arena) return arena->Allocate(size);
+  return static_cast<double*>(::operator new[](
+      size * sizeof(double), std::align_val_t(kS21SimdAlignment)));
+}
+
+void S21Matrix::FreeBuffer(double* buffer, S21MatrixArena* arena) noexcept {
+  if (arena) {
+    arena->Deallocate(buffer);
+  } else if (buffer) {
+    ::operator delete[](buffer, std::align_val_t(kS21SimdAlignment));
   }
 }
 
 void S21Matrix::ResetData() {
   matrix_ = nullptr;
+  arena_ = nullptr;
   rows_ = 0;
   cols_ = 0;
+  stride_ = 0;
+  capacity_ = 0;
 }
 
 S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
-  S21Matrix copy = other;
+  S21_INSTRUMENT_OPERATION(kCopy, 0);
+  S21Matrix copy(other.rows_, other.cols_, other.rows_, other.cols_, arena_);
+  copy.CopyMatrixValues(other);
   Swap(copy);
   return *this;
 }
 
+// A matrix keeps the storage it was created with: a result that lives in
+// another arena (or on the heap) is copied rather than adopted.
+void S21Matrix::Replace(S21Matrix&& result) {
+  if (result.arena_ == arena_) {
+    Swap(result);
+    return;
+  }
+  S21Matrix copy(result.rows_, result.cols_, result.rows_, result.cols_,
+                 arena_);
+  copy.CopyMatrixValues(result);
+  Swap(copy);
+}
+
 void S21Matrix::Swap(S21Matrix& other) {
   std::swap(rows_, other.rows_);
   std::swap(cols_, other.cols_);
+  std::swap(stride_, other.stride_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(arena_, other.arena_);
   std::swap(matrix_, other.matrix_);
 }
 
@@ -70,6 +176,9 @@ S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
 
     rows_ = other.rows_;
     cols_ = other.cols_;
+    stride_ = other.stride_;
+    capacity_ = other.capacity_;
+    arena_ = other.arena_;
     matrix_ = other.matrix_;
 
     other.ResetData();
@@ -78,109 +187,187 @@ S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
 }
 
 bool S21Matrix::EqMatrix(const S21Matrix& other) const {
+  S21_INSTRUMENT_OPERATION(kEqMatrix, static_cast<double>(rows_) * cols_);
   if (other.cols_ != cols_ || other.rows_ != rows_) return false;
 
+  if (IsContiguous() && other.IsContiguous()) {
+    return S21SimdAllClose(matrix_, other.matrix_,
+                           static_cast<std::size_t>(rows_) * cols_,
+                           S21_MATRIX_OOP_EPS);
+  }
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      if (fabs(matrix_[i][j] - other.matrix_[i][j]) > S21_MATRIX_OOP_EPS)
-        return false;
-    }
+    if (!S21SimdAllClose(RowData(i), other.RowData(i), cols_,
+                         S21_MATRIX_OOP_EPS))
+      return false;
   }
 
   return true;
 }
 
+bool S21Matrix::EqMatrix(const S21ConstMatrixView& other) const {
+  S21_INSTRUMENT_OPERATION(kEqMatrix, static_cast<double>(rows_) * cols_);
+  return S21ConstMatrixView(*this).EqMatrix(other);
+}
+
 void S21Matrix::SumMatrix(const S21Matrix& other) {
+  S21_INSTRUMENT_OPERATION(kSumMatrix, static_cast<double>(rows_) * cols_);
   CheckMatricesHaveSameDimensions(other);
+  AssignRows(*this, other, S21SimdAddInto);
+}
 
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] += other.matrix_[i][j];
-    }
-  }
+void S21Matrix::SumMatrix(const S21ConstMatrixView& other) {
+  S21_INSTRUMENT_OPERATION(kSumMatrix, static_cast<double>(rows_) * cols_);
+  S21MatrixView(*this).SumMatrix(other);
 }
 
 void S21Matrix::SubMatrix(const S21Matrix& other) {
+  S21_INSTRUMENT_OPERATION(kSubMatrix, static_cast<double>(rows_) * cols_);
   CheckMatricesHaveSameDimensions(other);
+  AssignRows(*this, other, S21SimdSubInto);
+}
+
+void S21Matrix::SubMatrix(const S21ConstMatrixView& other) {
+  S21_INSTRUMENT_OPERATION(kSubMatrix, static_cast<double>(rows_) * cols_);
+  S21MatrixView(*this).SubMatrix(other);
+}
 
+void S21Matrix::MulNumber(double num) {
+  S21_INSTRUMENT_OPERATION(kMulNumber, static_cast<double>(rows_) * cols_);
+  AssignScaled(*this, num);
+}
+
+void S21Matrix::AssignRows(const S21Matrix& first, const S21Matrix& second,
+                           void (*kernel)(double*, const double*,
+                                          const double*, std::size_t)) {
+  if (IsContiguous() && first.IsContiguous() && second.IsContiguous()) {
+    kernel(matrix_, first.matrix_, second.matrix_,
+           static_cast<std::size_t>(rows_) * cols_);
+    return;
+  }
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] -= other.matrix_[i][j];
-    }
+    kernel(RowData(i), first.RowData(i), second.RowData(i), cols_);
   }
 }
 
-void S21Matrix::MulNumber(double num) {
+void S21Matrix::AssignScaled(const S21Matrix& source, double num) {
+  if (IsContiguous() && source.IsContiguous()) {
+    S21SimdScaleInto(matrix_, num, source.matrix_,
+                     static_cast<std::size_t>(rows_) * cols_);
+    return;
+  }
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] *= num;
-    }
+    S21SimdScaleInto(RowData(i), num, source.RowData(i), cols_);
   }
 }
 
-void S21Matrix::MulMatrix(const S21Matrix& other) {
-  if (cols_ != other.rows_)
-    throw std::logic_error(
-        "The number of columns of the first matrix is not equal to the number "
-        "of rows of the second matrix");
+S21Matrix operator+(const S21Matrix& left, const S21Matrix& right) {
+  S21_INSTRUMENT_OPERATION(kSumMatrix,
+                           static_cast<double>(left.rows_) * left.cols_);
+  left.CheckMatricesHaveSameDimensions(right);
+  S21Matrix result(left.rows_, left.cols_, left.rows_, left.cols_,
+                   S21MatrixArena::Current());
+  result.AssignRows(left, right, S21SimdAddInto);
+  return result;
+}
 
-  S21Matrix result(rows_, other.cols_);
-  for (int i = 0; i < result.rows_; i++) {
-    for (int j = 0; j < result.cols_; j++) {
-      for (int k = 0; k < cols_; k++) {
-        result.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
-      }
-    }
-  }
+S21Matrix operator-(const S21Matrix& left, const S21Matrix& right) {
+  S21_INSTRUMENT_OPERATION(kSubMatrix,
+                           static_cast<double>(left.rows_) * left.cols_);
+  left.CheckMatricesHaveSameDimensions(right);
+  S21Matrix result(left.rows_, left.cols_, left.rows_, left.cols_,
+                   S21MatrixArena::Current());
+  result.AssignRows(left, right, S21SimdSubInto);
+  return result;
+}
 
-  *this = std::move(result);
+S21Matrix operator-(const S21Matrix& left, S21Matrix&& right) {
+  S21_INSTRUMENT_OPERATION(kSubMatrix,
+                           static_cast<double>(left.rows_) * left.cols_);
+  right.CheckMatricesHaveSameDimensions(left);
+  right.AssignRows(left, right, S21SimdSubInto);
+  return std::move(right);
+}
+
+S21Matrix operator*(const S21Matrix& matrix, double num) {
+  S21_INSTRUMENT_OPERATION(kMulNumber,
+                           static_cast<double>(matrix.rows_) * matrix.cols_);
+  S21Matrix result(matrix.rows_, matrix.cols_, matrix.rows_, matrix.cols_,
+                   S21MatrixArena::Current());
+  result.AssignScaled(matrix, num);
+  return result;
+}
+
+S21Matrix operator*(double num, const S21Matrix& matrix) {
+  return matrix * num;
+}
+
+void S21Matrix::MulMatrix(const S21Matrix& other) { Replace(*this * other); }
+
+void S21Matrix::MulMatrix(const S21ConstMatrixView& other) {
+  S21_INSTRUMENT_OPERATION(kMulMatrix, 2.0 * rows_ * cols_ * other.GetCols());
+  Replace(S21ConstMatrixView(*this) * other);
 }
 
 S21Matrix S21Matrix::Transpose() const {
+  S21_INSTRUMENT_OPERATION(kTranspose, 0);
   S21Matrix result(cols_, rows_);
-  for (int i = 0; i < result.rows_; i++) {
-    for (int j = 0; j < result.cols_; j++) {
-      result.matrix_[i][j] = matrix_[j][i];
-    }
-  }
+  S21SimdTranspose(rows_, cols_, matrix_, stride_, result.matrix_,
+                   result.stride_);
   return result;
 }
 
+void S21Matrix::TransposeInPlace() {
+  if (rows_ != cols_) {
+    Replace(Transpose());
+    return;
+  }
+  S21_INSTRUMENT_OPERATION(kTranspose, 0);
+  S21SimdTransposeInPlace(rows_, matrix_, stride_);
+}
+
+S21ConstMatrixView S21Matrix::T() const noexcept {
+  return S21ConstMatrixView(*this).T();
+}
+
+S21MatrixView S21Matrix::T() noexcept { return S21MatrixView(*this).T(); }
+
+S21ConstMatrixView S21Matrix::Block(int row, int col, int rows,
+                                    int cols) const {
+  return S21ConstMatrixView(*this).Block(row, col, rows, cols);
+}
+
+S21MatrixView S21Matrix::Block(int row, int col, int rows, int cols) {
+  return S21MatrixView(*this).Block(row, col, rows, cols);
+}
+
 S21Matrix S21Matrix::CalcComplements() const {
   CheckMatrixIsSquare();
+  S21_INSTRUMENT_OPERATION(kCalcComplements, 2.0 * rows_ * rows_ * rows_);
   int size = rows_;
   S21Matrix result(size, size);
   if (size == 1) {
-    result.matrix_[0][0] = 1;
-  } else {
-    S21Matrix minor(size - 1, size - 1);
-    for (int i = 0; i < size; i++) {
-      for (int j = 0; j < size; j++) {
-        FillMinor(i, j, minor);
-        int sign = ((i + j) % 2 ? -1 : 1);
-        result.matrix_[i][j] = minor.Determinant() * sign;
-      }
-    }
+    result.matrix_[0] = 1;
+    return result;
   }
+
+  S21LuDecomposition lu(*this);
+  if (lu.IsSingular()) return SingularComplements();
+
+  result = lu.Inverse();
+  result.TransposeInPlace();
+  result.MulNumber(lu.Determinant());
   return result;
 }
 
-void S21Matrix::FillMinor(int row, int col, S21Matrix& minor) const {
-  CheckMatrixIndexesAreInRange(row, col);
-
-  int past_row = 0;
-  for (int i = 0; i < rows_ - 1; i++) {
-    int past_col = 0;
-    if (i == row) {
-      past_row = 1;
-    }
-    for (int j = 0; j < cols_ - 1; j++) {
-      if (j == col) {
-        past_col = 1;
-      }
-      minor.matrix_[i][j] = matrix_[i + past_row][j + past_col];
-    }
-  }
+S21Matrix S21Matrix::SingularComplements() const {
+  int size = rows_;
+  double tolerance =
+      size * std::numeric_limits<double>::epsilon() * MaxAbsValue();
+  S21Matrix lu(*this);
+  S21Matrix result(size, size);
+  S21BasicSingularComplements(size, lu.matrix_, lu.stride_, tolerance,
+                              result.matrix_, result.stride_);
+  return result;
 }
 
 void S21Matrix::CheckMatrixIndexesAreInRange(int row, int col) const {
@@ -190,28 +377,44 @@ void S21Matrix::CheckMatrixIndexesAreInRange(int row, int col) const {
 
 double S21Matrix::Determinant() const {
   CheckMatrixIsSquare();
-  int size = rows_;
+  S21_INSTRUMENT_OPERATION(kDeterminant, 2.0 / 3.0 * rows_ * rows_ * rows_);
+  return S21LuDecomposition(*this).Determinant();
+}
+
+double S21Matrix::LogAbsDeterminant(int& sign) const {
+  CheckMatrixIsSquare();
+  S21_INSTRUMENT_OPERATION(kDeterminant, 2.0 / 3.0 * rows_ * rows_ * rows_);
+  return S21LuDecomposition(*this).LogAbsDeterminant(sign);
+}
+
+double S21Matrix::MaxAbsValue() const {
   double result = 0;
-  if (size == 1) {
-    result = matrix_[0][0];
-  } else {
-    S21Matrix minor(size - 1, size - 1);
-    for (int j = 0; j < cols_; j++) {
-      FillMinor(0, j, minor);
-      int sign = (j % 2 ? -1 : 1);
-      result += matrix_[0][j] * minor.Determinant() * sign;
-    }
+  for (int i = 0; i < rows_; i++) {
+    const double* row = RowData(i);
+    for (int j = 0; j < cols_; j++) result = std::max(result, fabs(row[j]));
   }
   return result;
 }
 
 S21Matrix S21Matrix::InverseMatrix() const {
-  double det = Determinant();
-  if (det == 0) throw std::logic_error("The matrix is not invertible");
-  S21Matrix result = CalcComplements();
-  result = result.Transpose();
-  result.MulNumber(1 / det);
-  return result;
+  CheckMatrixIsSquare();
+  S21_INSTRUMENT_OPERATION(kInverseMatrix, 2.0 * rows_ * rows_ * rows_);
+  return S21LuDecomposition(*this).Inverse();
+}
+
+S21Matrix S21Matrix::Solve(const S21Matrix& rhs) const {
+  CheckMatrixIsSquare();
+  S21_INSTRUMENT_OPERATION(kSolve, 2.0 / 3.0 * rows_ * rows_ * rows_ +
+                                       2.0 * rows_ * rows_ * rhs.cols_);
+  return S21LuDecomposition(*this).Solve(rhs);
+}
+
+std::vector<S21Matrix> S21Matrix::SolveMany(
+    const std::vector<S21Matrix>& rhs) const {
+  CheckMatrixIsSquare();
+  S21_INSTRUMENT_OPERATION(kSolve, 2.0 / 3.0 * rows_ * rows_ * rows_ +
+                                       2.0 * rows_ * rows_ * RhsCols(rhs));
+  return S21LuDecomposition(*this).SolveMany(rhs);
 }
 
 void S21Matrix::CheckMatrixIsSquare() const {
@@ -221,7 +424,11 @@ void S21Matrix::CheckMatrixIsSquare() const {
 }
 
 void S21Matrix::CheckMatricesHaveSameDimensions(const S21Matrix& other) const {
-  if (rows_ != other.rows_ || cols_ != other.cols_)
+  CheckMatrixHasDimensions(other.rows_, other.cols_);
+}
+
+void S21Matrix::CheckMatrixHasDimensions(int rows, int cols) const {
+  if (rows_ != rows || cols_ != cols)
     throw std::logic_error("Matrices must have the same dimensions");
 }
 
@@ -244,27 +451,16 @@ S21Matrix& S21Matrix::operator*=(double num) {
   return *this;
 }
 
-S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
-  S21Matrix result(*this);
-  result.SumMatrix(other);
-  return result;
-}
-
-S21Matrix S21Matrix::operator-(const S21Matrix& other) const {
-  S21Matrix result(*this);
-  result.SubMatrix(other);
-  return result;
-}
-
 S21Matrix S21Matrix::operator*(const S21Matrix& other) const {
-  S21Matrix result(*this);
-  result.MulMatrix(other);
-  return result;
-}
+  if (cols_ != other.rows_)
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
 
-S21Matrix S21Matrix::operator*(double num) const {
-  S21Matrix result(*this);
-  result.MulNumber(num);
+  S21_INSTRUMENT_OPERATION(kMulMatrix, 2.0 * rows_ * cols_ * other.cols_);
+  S21Matrix result(rows_, other.cols_);
+  S21Gemm(rows_, other.cols_, cols_, matrix_, stride_, 1, other.matrix_,
+          other.stride_, 1, result.matrix_, result.stride_);
   return result;
 }
 
@@ -274,47 +470,275 @@ bool S21Matrix::operator==(const S21Matrix& other) const {
 
 double& S21Matrix::operator()(int row, int col) {
   CheckMatrixIndexesAreInRange(row, col);
-  return matrix_[row][col];
+  return RowData(row)[col];
 }
 
 const double& S21Matrix::operator()(int row, int col) const {
   CheckMatrixIndexesAreInRange(row, col);
-  return matrix_[row][col];
+  return RowData(row)[col];
+}
+
+S21Span<double> S21Matrix::Row(int row) {
+  CheckMatrixIndexesAreInRange(row, 0);
+  return S21Span<double>(RowData(row), cols_);
+}
+
+S21Span<const double> S21Matrix::Row(int row) const {
+  CheckMatrixIndexesAreInRange(row, 0);
+  return S21Span<const double>(RowData(row), cols_);
 }
 
 int S21Matrix::GetRows() const noexcept { return rows_; }
 
 int S21Matrix::GetCols() const noexcept { return cols_; }
 
+int S21Matrix::GetCapacity() const noexcept { return capacity_; }
+
 void S21Matrix::SetRows(int rows) {
   if (rows <= 0) throw std::logic_error("The number of rows must be positive");
+  CheckRowsAndColsArePositive();
+  S21_INSTRUMENT_OPERATION(kResize, 0);
 
-  if (rows < rows_) {
-    for (int i = rows_ - 1; i >= rows; i--) {
-      delete[] matrix_[i];
-    }
-    rows_ = rows;
-  } else if (rows > rows_) {
-    S21Matrix temp(rows, cols_);
-    temp.CopyMatrixValues(*this);
-    *this = std::move(temp);
-  }
+  if (rows > capacity_) *this = Reallocated(GrownCapacity(rows), stride_);
+  if (rows > rows_) std::fill(RowData(rows_), RowData(rows), 0.0);
+  rows_ = rows;
 }
 
 void S21Matrix::SetCols(int cols) {
   if (cols <= 0) throw std::logic_error("The number of rows must be positive");
+  CheckRowsAndColsArePositive();
+  S21_INSTRUMENT_OPERATION(kResize, 0);
+
+  if (cols > stride_) *this = Reallocated(capacity_, cols);
+  if (cols > cols_) {
+    for (int i = 0; i < rows_; i++) {
+      std::fill(RowData(i) + cols_, RowData(i) + cols, 0.0);
+    }
+  }
+  cols_ = cols;
+}
+
+void S21Matrix::Reserve(int rows) {
+  if (rows > capacity_) *this = Reallocated(rows, stride_);
+}
+
+void S21Matrix::ShrinkToFit() {
+  if (capacity_ != rows_ || stride_ != cols_) {
+    *this = Reallocated(rows_, cols_);
+  }
+}
+
+void S21Matrix::AppendRow(S21Span<const double> values) {
+  if (values.size() != static_cast<std::size_t>(cols_))
+    throw std::logic_error(
+        "The number of values is not equal to the number of columns");
+  S21_INSTRUMENT_OPERATION(kResize, 0);
+  AppendRowData(values.data(), cols_, 1);
+}
+
+void S21Matrix::AppendRows(const S21Matrix& other) {
+  if (other.cols_ != cols_)
+    throw std::logic_error("Matrices must have the same number of columns");
+  S21_INSTRUMENT_OPERATION(kResize, 0);
+  AppendRowData(other.matrix_, other.stride_, other.rows_);
+}
+
+void S21Matrix::AppendRowData(const double* data, std::ptrdiff_t stride,
+                              int count) {
+  CheckRowsAndColsArePositive();
+  int rows = rows_ + count;
+  if (rows > capacity_) {
+    // The rows may be this matrix's own, so they are copied before its
+    // buffer is released.
+    S21Matrix grown = Reallocated(GrownCapacity(rows), stride_);
+    grown.AppendRowData(data, stride, count);
+    *this = std::move(grown);
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    std::memcpy(RowData(rows_ + i), data + i * stride, cols_ * sizeof(double));
+  }
+  rows_ = rows;
+}
+
+// A copy with room for capacity rows of stride values; the rows past
+// rows_ and the padding are left uninitialized.
+S21Matrix S21Matrix::Reallocated(int capacity, int stride) const {
+  S21Matrix result(rows_, cols_, capacity, stride, arena_);
+  result.CopyMatrixValues(*this);
+  return result;
+}
 
-  S21Matrix temp(rows_, cols);
-  temp.CopyMatrixValues(*this);
-  *this = std::move(temp);
+int S21Matrix::GrownCapacity(int rows) const noexcept {
+  int doubled = capacity_ > std::numeric_limits<int>::max() / 2
+                    ? std::numeric_limits<int>::max()
+                    : 2 * capacity_;
+  return std::max(rows, doubled);
 }
 
 void S21Matrix::CopyMatrixValues(const S21Matrix& other) {
   int min_rows = std::min(rows_, other.rows_);
   int min_cols = std::min(cols_, other.cols_);
-  for (int i = 0; i < min_rows; i++) {
-    for (int j = 0; j < min_cols; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
+  if (min_cols == cols_ && min_cols == other.cols_ && IsContiguous() &&
+      other.IsContiguous()) {
+    std::memcpy(matrix_, other.matrix_,
+                static_cast<std::size_t>(min_rows) * min_cols * sizeof(double));
+  } else {
+    for (int i = 0; i < min_rows; i++) {
+      std::memcpy(RowData(i), other.RowData(i), min_cols * sizeof(double));
+    }
+  }
+}
+void S21Matrix::CopyMatrixValues(const S21ExecutionPolicy& policy,
+                                 const S21Matrix& other) {
+  int min_rows = std::min(rows_, other.rows_);
+  int min_cols = std::min(cols_, other.cols_);
+  int chunks = S21RowChunkCount(policy, min_rows, min_cols);
+  if (chunks == 1) return CopyMatrixValues(other);
+  S21ForEachRowChunk(chunks, min_rows, [&](int, int begin, int end) {
+    ForRowSpans(begin, end, min_cols, matrix_, stride_, other.matrix_,
+                other.stride_,
+                [](double* row, const double* other_row, std::size_t size) {
+                  std::memcpy(row, other_row, size * sizeof(double));
+                });
+  });
+}
+
+bool S21Matrix::EqMatrix(const S21ExecutionPolicy& policy,
+                         const S21Matrix& other) const {
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  if (chunks == 1) return EqMatrix(other);
+  S21_INSTRUMENT_OPERATION(kEqMatrix, static_cast<double>(rows_) * cols_);
+  if (other.cols_ != cols_ || other.rows_ != rows_) return false;
+
+  std::atomic<bool> equal(true);
+  S21ForEachRowChunk(chunks, rows_, [&](int, int begin, int end) {
+    ForRowSpans(begin, end, cols_, matrix_, stride_, other.matrix_,
+                other.stride_,
+                [&](const double* row, const double* other_row,
+                    std::size_t size) {
+                  if (equal.load(std::memory_order_relaxed) &&
+                      !S21SimdAllClose(row, other_row, size,
+                                       S21_MATRIX_OOP_EPS))
+                    equal.store(false, std::memory_order_relaxed);
+                });
+  });
+  return equal.load();
+}
+
+void S21Matrix::SumMatrix(const S21ExecutionPolicy& policy,
+                          const S21Matrix& other) {
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  if (chunks == 1) return SumMatrix(other);
+  S21_INSTRUMENT_OPERATION(kSumMatrix, static_cast<double>(rows_) * cols_);
+  CheckMatricesHaveSameDimensions(other);
+  S21ForEachRowChunk(chunks, rows_, [&](int, int begin, int end) {
+    ForRowSpans(begin, end, cols_, matrix_, stride_, other.matrix_,
+                other.stride_, S21SimdAdd);
+  });
+}
+
+void S21Matrix::SubMatrix(const S21ExecutionPolicy& policy,
+                          const S21Matrix& other) {
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  if (chunks == 1) return SubMatrix(other);
+  S21_INSTRUMENT_OPERATION(kSubMatrix, static_cast<double>(rows_) * cols_);
+  CheckMatricesHaveSameDimensions(other);
+  S21ForEachRowChunk(chunks, rows_, [&](int, int begin, int end) {
+    ForRowSpans(begin, end, cols_, matrix_, stride_, other.matrix_,
+                other.stride_, S21SimdSub);
+  });
+}
+
+void S21Matrix::MulNumber(const S21ExecutionPolicy& policy, double num) {
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  if (chunks == 1) return MulNumber(num);
+  S21_INSTRUMENT_OPERATION(kMulNumber, static_cast<double>(rows_) * cols_);
+  S21ForEachRowChunk(chunks, rows_, [&](int, int begin, int end) {
+    ForRowSpans(begin, end, cols_, matrix_, stride_, matrix_, stride_,
+                [num](double* row, double*, std::size_t size) {
+                  S21SimdScale(row, num, size);
+                });
+  });
+}
+
+double S21Matrix::SumOverRows(const S21ExecutionPolicy& policy,
+                              double (*row_sum)(const double*, const double*,
+                                                std::size_t),
+                              const S21Matrix& other) const {
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  std::vector<double> partial(chunks, 0.0);
+  S21ForEachRowChunk(chunks, rows_, [&](int chunk, int begin, int end) {
+    ForRowSpans(begin, end, cols_, matrix_, stride_, other.matrix_,
+                other.stride_,
+                [&](const double* row, const double* other_row,
+                    std::size_t size) {
+                  partial[chunk] += row_sum(row, other_row, size);
+                });
+  });
+  double result = 0;
+  for (double value : partial) result += value;
+  return result;
+}
+
+double S21Matrix::Sum(const S21ExecutionPolicy& policy) const {
+  return SumOverRows(
+      policy,
+      [](const double* row, const double*, std::size_t size) {
+        return S21SimdSum(row, size);
+      },
+      *this);
+}
+
+double S21Matrix::Dot(const S21Matrix& other) const {
+  return Dot(kS21Seq, other);
+}
+
+double S21Matrix::Dot(const S21ExecutionPolicy& policy,
+                      const S21Matrix& other) const {
+  CheckMatricesHaveSameDimensions(other);
+  return SumOverRows(policy, S21SimdDot, other);
+}
+
+double S21Matrix::FrobeniusNorm(const S21ExecutionPolicy& policy) const {
+  return sqrt(SumOverRows(policy, S21SimdDot, *this));
+}
+
+double S21Matrix::NormOne(const S21ExecutionPolicy& policy) const {
+  // Like the sums, the norms of an empty (moved-from) matrix are zero.
+  if (rows_ == 0 || cols_ == 0) return 0;
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  std::vector<std::vector<double>> column_sums(chunks);
+  S21ForEachRowChunk(chunks, rows_, [&](int chunk, int begin, int end) {
+    std::vector<double>& sums = column_sums[chunk];
+    sums.assign(cols_, 0.0);
+    for (int i = begin; i < end; i++) {
+      S21SimdAddAbs(sums.data(), RowData(i), cols_);
     }
+  });
+  for (int chunk = 1; chunk < chunks; chunk++) {
+    if (column_sums[chunk].empty()) continue;
+    S21SimdAdd(column_sums[0].data(), column_sums[chunk].data(), cols_);
   }
-}
\ No newline at end of file
+  return *std::max_element(column_sums[0].begin(), column_sums[0].end());
+}
+
+double S21Matrix::NormInf(const S21ExecutionPolicy& policy) const {
+  if (rows_ == 0 || cols_ == 0) return 0;
+  int chunks = S21RowChunkCount(policy, rows_, cols_);
+  std::vector<double> partial(chunks, 0.0);
+  S21ForEachRowChunk(chunks, rows_, [&](int chunk, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      partial[chunk] =
+          std::max(partial[chunk], S21SimdSumAbs(RowData(i), cols_));
+    }
+  });
+  return *std::max_element(partial.begin(), partial.end());
+}
+
+double S21Matrix::Trace() const {
+  CheckMatrixIsSquare();
+  double result = 0;
+  for (int i = 0; i < rows_; i++) result += RowData(i)[i];
+  return result;
+}
@@ -1,63 +1,221 @@
 #ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_OOP_H_
 #define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_OOP_H_
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <string>
+#include <vector>
+
+#include "s21_execution.h"
+#include "s21_matrix_iterator.h"
 
 #define S21_MATRIX_OOP_EPS 1e-7
 
+template <typename E>
+class S21MatrixExpression;
+class S21MatrixTerm;
+class S21ConstMatrixView;
+class S21MatrixView;
+class S21MatrixArena;
+
 class S21Matrix {
+  friend class S21LuDecomposition;
+  friend class S21CholeskyDecomposition;
+  friend class S21MixedPrecisionSolver;
+  friend class S21MatrixTerm;
+  friend class S21ConstMatrixView;
+  friend S21Matrix operator+(const S21Matrix& left, const S21Matrix& right);
+  friend S21Matrix operator-(const S21Matrix& left, const S21Matrix& right);
+  friend S21Matrix operator-(const S21Matrix& left, S21Matrix&& right);
+  friend S21Matrix operator*(const S21Matrix& matrix, double num);
+
  private:
   int rows_, cols_;
-  double** matrix_;
+  int stride_;
+  // Rows the buffer has room for; SetRows and AppendRow grow it
+  // geometrically, like std::vector.
+  int capacity_;
+  S21MatrixArena* arena_;
+  double* matrix_;
 
  public:
+  using iterator = S21MatrixIterator<double>;
+  using const_iterator = S21MatrixIterator<const double>;
+
   S21Matrix();
   S21Matrix(int rows, int cols);
   S21Matrix(const S21Matrix& other);
   S21Matrix(S21Matrix&& other) noexcept;
+  template <typename E>
+  S21Matrix(const S21MatrixExpression<E>& expression);
+  explicit S21Matrix(const S21ConstMatrixView& view);
+  S21Matrix(const S21ExecutionPolicy& policy, const S21Matrix& other);
   ~S21Matrix();
 
   S21Matrix& operator=(const S21Matrix& other);
   S21Matrix& operator=(S21Matrix&& other) noexcept;
+  template <typename E>
+  S21Matrix& operator=(const S21MatrixExpression<E>& expression);
   bool operator==(const S21Matrix& other) const;
-  S21Matrix operator+(const S21Matrix& other) const;
-  S21Matrix operator-(const S21Matrix& other) const;
   S21Matrix operator*(const S21Matrix& other) const;
-  S21Matrix operator*(double num) const;
   S21Matrix& operator+=(const S21Matrix& other);
   S21Matrix& operator-=(const S21Matrix& other);
+  template <typename E>
+  S21Matrix& operator+=(const S21MatrixExpression<E>& expression);
+  template <typename E>
+  S21Matrix& operator-=(const S21MatrixExpression<E>& expression);
   S21Matrix& operator*=(const S21Matrix& other);
   S21Matrix& operator*=(double num);
   double& operator()(int row, int col);
   const double& operator()(int row, int col) const;
+  // Unchecked element access for inner loops; the indexes are only asserted
+  // in debug builds.
+  double& At(int row, int col) noexcept {
+    assert(row >= 0 && row < rows_ && col >= 0 && col < cols_);
+    return RowData(row)[col];
+  }
+  const double& At(int row, int col) const noexcept {
+    assert(row >= 0 && row < rows_ && col >= 0 && col < cols_);
+    return RowData(row)[col];
+  }
+  S21Span<double> Row(int row);
+  S21Span<const double> Row(int row) const;
+  // Row i starts at Data() + i * GetStride(); rows may be padded.
+  double* Data() noexcept { return matrix_; }
+  const double* Data() const noexcept { return matrix_; }
+  int GetStride() const noexcept { return stride_; }
+
+  iterator begin() noexcept { return MakeIterator(matrix_); }
+  iterator end() noexcept { return MakeIterator(RowData(rows_)); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept { return MakeIterator(matrix_); }
+  const_iterator cend() const noexcept {
+    return MakeIterator(RowData(rows_));
+  }
 
   bool EqMatrix(const S21Matrix& other) const;
+  bool EqMatrix(const S21ConstMatrixView& other) const;
   void SumMatrix(const S21Matrix& other);
+  void SumMatrix(const S21ConstMatrixView& other);
   void SubMatrix(const S21Matrix& other);
+  void SubMatrix(const S21ConstMatrixView& other);
   void MulNumber(double num);
+  bool EqMatrix(const S21ExecutionPolicy& policy,
+                const S21Matrix& other) const;
+  void SumMatrix(const S21ExecutionPolicy& policy, const S21Matrix& other);
+  void SubMatrix(const S21ExecutionPolicy& policy, const S21Matrix& other);
+  void MulNumber(const S21ExecutionPolicy& policy, double num);
   void MulMatrix(const S21Matrix& other);
+  void MulMatrix(const S21ConstMatrixView& other);
   S21Matrix Transpose() const;
+  // Square matrices are transposed without allocating; others are replaced
+  // by their transpose.
+  void TransposeInPlace();
+  // The matrix as an operand of a fused element-wise expression; see
+  // s21_matrix_expression.h.
+  S21MatrixTerm Lazy() const noexcept;
+  S21ConstMatrixView T() const noexcept;
+  S21MatrixView T() noexcept;
+  S21ConstMatrixView Block(int row, int col, int rows, int cols) const;
+  S21MatrixView Block(int row, int col, int rows, int cols);
   S21Matrix CalcComplements() const;
   double Determinant() const;
+  double LogAbsDeterminant(int& sign) const;
   S21Matrix InverseMatrix() const;
+  S21Matrix Solve(const S21Matrix& rhs) const;
+  // NormOne is the largest column sum of |a_ij|, NormInf the largest row sum
+  // and Dot the sum of a_ij * b_ij. Partial sums are combined in row order,
+  // so a result depends on the number of chunks but not on thread timing.
+  double Sum(const S21ExecutionPolicy& policy = kS21Seq) const;
+  double Dot(const S21Matrix& other) const;
+  double Dot(const S21ExecutionPolicy& policy, const S21Matrix& other) const;
+  double FrobeniusNorm(const S21ExecutionPolicy& policy = kS21Seq) const;
+  double NormOne(const S21ExecutionPolicy& policy = kS21Seq) const;
+  double NormInf(const S21ExecutionPolicy& policy = kS21Seq) const;
+  double Trace() const;
+  std::vector<S21Matrix> SolveMany(const std::vector<S21Matrix>& rhs) const;
+  // Binary I/O in the format described in s21_matrix_io.h.
+  void Save(const std::string& path) const;
+  static S21Matrix Load(const std::string& path);
 
   int GetRows() const noexcept;
   int GetCols() const noexcept;
+  int GetCapacity() const noexcept;
+  // Shrinking keeps the buffer: SetRows keeps the spare rows and SetCols
+  // leaves the rows padded. The new elements of a grown matrix are zero.
   void SetRows(int rows);
   void SetCols(int cols);
+  void Reserve(int rows);
+  void ShrinkToFit();
+  // Appending n rows one at a time costs amortized O(n * cols).
+  void AppendRow(S21Span<const double> values);
+  void AppendRows(const S21Matrix& other);
 
  private:
+  S21Matrix(int rows, int cols, int capacity, int stride,
+            S21MatrixArena* arena);
+
   void CheckRowsAndColsArePositive() const;
   void CheckMatrixIndexesAreInRange(int row, int col) const;
   void CheckMatrixIsSquare() const;
   void CheckMatricesHaveSameDimensions(const S21Matrix& other) const;
+  void CheckMatrixHasDimensions(int rows, int cols) const;
   void CreateMatrix();
   void ResetData();
   void DeleteMatrix();
-  void FillMinor(int row, int col, S21Matrix& minor) const;
+  double MaxAbsValue() const;
+  S21Matrix SingularComplements() const;
   void CopyMatrixValues(const S21Matrix& other);
+  void CopyMatrixValues(const S21ExecutionPolicy& policy,
+                        const S21Matrix& other);
+  double SumOverRows(const S21ExecutionPolicy& policy,
+                     double (*row_sum)(const double*, const double*,
+                                       std::size_t),
+                     const S21Matrix& other) const;
   void Swap(S21Matrix& other);
+  // Write kernel(first, second) or num * source into this matrix, which has
+  // the operands' dimensions; it may be one of the operands.
+  void AssignRows(const S21Matrix& first, const S21Matrix& second,
+                  void (*kernel)(double*, const double*, const double*,
+                                 std::size_t));
+  void AssignScaled(const S21Matrix& source, double num);
+  void Replace(S21Matrix&& result);
+  S21Matrix Reallocated(int capacity, int stride) const;
+  int GrownCapacity(int rows) const noexcept;
+  void AppendRowData(const double* data, std::ptrdiff_t stride, int count);
+  template <typename E, typename Operation>
+  void AssignExpression(const E& expression, Operation, bool accumulate);
+  bool IsContiguous() const noexcept { return stride_ == cols_; }
+  double* RowData(int row) noexcept {
+    return matrix_ + static_cast<std::size_t>(row) * stride_;
+  }
+  const double* RowData(int row) const noexcept {
+    return matrix_ + static_cast<std::size_t>(row) * stride_;
+  }
+
+  template <typename T>
+  S21MatrixIterator<T> MakeIterator(T* row) const noexcept {
+    return S21MatrixIterator<T>(row, 0, std::max(cols_, 1),
+                                std::max(stride_, 1));
+  }
+
+  static double* AllocateBuffer(std::size_t size, S21MatrixArena* arena);
+  static void FreeBuffer(double* buffer, S21MatrixArena* arena) noexcept;
 };
 
+// Each returns a new matrix computed with the SIMD kernels of s21_simd.h.
+S21Matrix operator+(const S21Matrix& left, const S21Matrix& right);
+S21Matrix operator-(const S21Matrix& left, const S21Matrix& right);
+// Writes the difference into the temporary's buffer.
+S21Matrix operator-(const S21Matrix& left, S21Matrix&& right);
+S21Matrix operator*(const S21Matrix& matrix, double num);
+S21Matrix operator*(double num, const S21Matrix& matrix);
+
+#include "s21_matrix_expression.h"
+#include "s21_matrix_view.h"
+
 #endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_OOP_H_
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "s21_matrix_view.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_gemm.h"
+#include "s21_simd.h"
+
+S21ConstMatrixView::S21ConstMatrixView(const S21Matrix& matrix) noexcept
+    : data_(matrix.matrix_),
+      rows_(matrix.rows_),
+      cols_(matrix.cols_),
+      row_stride_(matrix.stride_),
+      col_stride_(1) {}
+
+S21ConstMatrixView::S21ConstMatrixView(const double* data, int rows, int cols,
+                                       std::ptrdiff_t row_stride,
+                                       std::ptrdiff_t col_stride) noexcept
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      row_stride_(row_stride),
+      col_stride_(col_stride) {}
+
+const double& S21ConstMatrixView::operator()(int row, int col) const {
+  CheckIndexesAreInRange(row, col);
+  return *Address(row, col);
+}
+
+S21ConstMatrixView S21ConstMatrixView::T() const noexcept {
+  return S21ConstMatrixView(data_, cols_, rows_, col_stride_, row_stride_);
+}
+
+S21ConstMatrixView S21ConstMatrixView::Block(int row, int col, int rows,
+                                             int cols) const {
+  CheckBlockIsInRange(row, col, rows, cols);
+  return S21ConstMatrixView(Address(row, col), rows, cols, row_stride_,
+                            col_stride_);
+}
+
+bool S21ConstMatrixView::EqMatrix(const S21ConstMatrixView& other) const {
+  if (other.rows_ != rows_ || other.cols_ != cols_) return false;
+
+  if (col_stride_ == 1 && other.col_stride_ == 1) {
+    for (int i = 0; i < rows_; i++) {
+      if (!S21SimdAllClose(Address(i, 0), other.Address(i, 0), cols_,
+                           S21_MATRIX_OOP_EPS))
+        return false;
+    }
+    return true;
+  }
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      if (fabs(*Address(i, j) - *other.Address(i, j)) > S21_MATRIX_OOP_EPS)
+        return false;
+    }
+  }
+  return true;
+}
+
+void S21ConstMatrixView::CheckIndexesAreInRange(int row, int col) const {
+  if (row >= rows_ || row < 0 || col >= cols_ || col < 0)
+    throw std::out_of_range("Index is outside the matrix");
+}
+
+void S21ConstMatrixView::CheckBlockIsInRange(int row, int col, int rows,
+                                             int cols) const {
+  if (rows <= 0 || cols <= 0)
+    throw std::logic_error(
+        "Numbers of rows and columns in a matrix must be positive");
+  if (row < 0 || col < 0 || row > rows_ - rows || col > cols_ - cols)
+    throw std::out_of_range("Block is outside the matrix");
+}
+
+void S21ConstMatrixView::CheckHasDimensions(int rows, int cols) const {
+  if (rows_ != rows || cols_ != cols)
+    throw std::logic_error("Matrices must have the same dimensions");
+}
+
+// Compares the address ranges spanned by the two views, so views that merely
+// interleave, like two columns of one matrix, count as overlapping too.
+bool S21ConstMatrixView::Overlaps(
+    const S21ConstMatrixView& other) const noexcept {
+  auto extent = [](const S21ConstMatrixView& view) {
+    std::ptrdiff_t rows = (view.rows_ - 1) * view.row_stride_;
+    std::ptrdiff_t cols = (view.cols_ - 1) * view.col_stride_;
+    return std::make_pair(
+        view.data_ + std::min<std::ptrdiff_t>(rows, 0) +
+            std::min<std::ptrdiff_t>(cols, 0),
+        view.data_ + std::max<std::ptrdiff_t>(rows, 0) +
+            std::max<std::ptrdiff_t>(cols, 0));
+  };
+  auto [first, last] = extent(*this);
+  auto [other_first, other_last] = extent(other);
+  std::less<const double*> less;
+  return !less(last, other_first) && !less(other_last, first);
+}
+
+S21MatrixView::S21MatrixView(S21Matrix& matrix) noexcept
+    : S21ConstMatrixView(matrix) {}
+
+S21MatrixView::S21MatrixView(double* data, int rows, int cols,
+                             std::ptrdiff_t row_stride,
+                             std::ptrdiff_t col_stride) noexcept
+    : S21ConstMatrixView(data, rows, cols, row_stride, col_stride) {}
+
+double& S21MatrixView::operator()(int row, int col) const {
+  CheckIndexesAreInRange(row, col);
+  return *MutableAddress(row, col);
+}
+
+S21MatrixView S21MatrixView::T() const noexcept {
+  return S21MatrixView(Data(), cols_, rows_, col_stride_, row_stride_);
+}
+
+S21MatrixView S21MatrixView::Block(int row, int col, int rows,
+                                   int cols) const {
+  CheckBlockIsInRange(row, col, rows, cols);
+  return S21MatrixView(MutableAddress(row, col), rows, cols, row_stride_,
+                       col_stride_);
+}
+
+template <typename Operation>
+void S21MatrixView::Update(const S21ConstMatrixView& other,
+                           Operation operation) const {
+  other.CheckHasDimensions(rows_, cols_);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      double& element = *MutableAddress(i, j);
+      element = operation(element, *other.Address(i, j));
+    }
+  }
+}
+
+void S21MatrixView::Assign(const S21ConstMatrixView& other) const {
+  Update(other, [](double, double value) { return value; });
+}
+
+void S21MatrixView::SumMatrix(const S21ConstMatrixView& other) const {
+  if (col_stride_ == 1 && other.col_stride_ == 1) {
+    other.CheckHasDimensions(rows_, cols_);
+    for (int i = 0; i < rows_; i++) {
+      S21SimdAdd(MutableAddress(i, 0), other.Address(i, 0), cols_);
+    }
+    return;
+  }
+  Update(other, [](double element, double value) { return element + value; });
+}
+
+void S21MatrixView::SubMatrix(const S21ConstMatrixView& other) const {
+  if (col_stride_ == 1 && other.col_stride_ == 1) {
+    other.CheckHasDimensions(rows_, cols_);
+    for (int i = 0; i < rows_; i++) {
+      S21SimdSub(MutableAddress(i, 0), other.Address(i, 0), cols_);
+    }
+    return;
+  }
+  Update(other, [](double element, double value) { return element - value; });
+}
+
+void S21MatrixView::MulNumber(double num) const {
+  if (col_stride_ == 1 || row_stride_ == 1) {
+    S21MatrixView rows = col_stride_ == 1 ? *this : T();
+    for (int i = 0; i < rows.rows_; i++) {
+      S21SimdScale(rows.MutableAddress(i, 0), num, rows.cols_);
+    }
+    return;
+  }
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) *MutableAddress(i, j) *= num;
+  }
+}
+
+void S21MatrixView::AddProduct(const S21ConstMatrixView& left,
+                               const S21ConstMatrixView& right,
+                               double alpha) const {
+  if (left.cols_ != right.rows_)
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+  CheckHasDimensions(left.rows_, right.cols_);
+
+  bool disjoint = !Overlaps(left) && !Overlaps(right);
+  if (disjoint && col_stride_ == 1) {
+    S21Gemm(rows_, cols_, left.cols_, left.data_, left.row_stride_,
+            left.col_stride_, right.data_, right.row_stride_,
+            right.col_stride_, Data(), row_stride_, alpha);
+  } else if (disjoint && row_stride_ == 1) {
+    S21Gemm(cols_, rows_, left.cols_, right.data_, right.col_stride_,
+            right.row_stride_, left.data_, left.col_stride_, left.row_stride_,
+            Data(), col_stride_, alpha);
+  } else {
+    S21Matrix product = left * right;
+    product.MulNumber(alpha);
+    SumMatrix(product);
+  }
+}
+
+S21Matrix operator*(const S21ConstMatrixView& left,
+                    const S21ConstMatrixView& right) {
+  if (left.GetCols() != right.GetRows())
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+
+  S21Matrix result(left.GetRows(), right.GetCols());
+  S21MatrixView(result).AddProduct(left, right);
+  return result;
+}
@@ -0,0 +1,81 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_VIEW_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_VIEW_H_
+
+#include <cstddef>
+
+#include "s21_matrix_oop.h"
+
+// Non-owning windows onto the storage of an S21Matrix: a block, a transpose,
+// or any combination of the two. Views hold a pointer and two strides, so they
+// are created and copied without allocating, and must not outlive the matrix
+// they refer to.
+class S21ConstMatrixView {
+  friend class S21MatrixView;
+
+ public:
+  S21ConstMatrixView(const S21Matrix& matrix) noexcept;
+  S21ConstMatrixView(const double* data, int rows, int cols,
+                     std::ptrdiff_t row_stride,
+                     std::ptrdiff_t col_stride) noexcept;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  std::ptrdiff_t GetRowStride() const noexcept { return row_stride_; }
+  std::ptrdiff_t GetColStride() const noexcept { return col_stride_; }
+  const double* Data() const noexcept { return data_; }
+
+  const double& operator()(int row, int col) const;
+  S21ConstMatrixView T() const noexcept;
+  S21ConstMatrixView Block(int row, int col, int rows, int cols) const;
+  bool EqMatrix(const S21ConstMatrixView& other) const;
+
+ protected:
+  const double* Address(int row, int col) const noexcept {
+    return data_ + row * row_stride_ + col * col_stride_;
+  }
+  void CheckIndexesAreInRange(int row, int col) const;
+  void CheckBlockIsInRange(int row, int col, int rows, int cols) const;
+  void CheckHasDimensions(int rows, int cols) const;
+  bool Overlaps(const S21ConstMatrixView& other) const noexcept;
+
+  const double* data_;
+  int rows_, cols_;
+  std::ptrdiff_t row_stride_, col_stride_;
+};
+
+// A view through which the elements can be modified. The source of an
+// element-wise update must either not overlap the view or coincide with it
+// element for element.
+class S21MatrixView : public S21ConstMatrixView {
+ public:
+  S21MatrixView(S21Matrix& matrix) noexcept;
+  S21MatrixView(double* data, int rows, int cols, std::ptrdiff_t row_stride,
+                std::ptrdiff_t col_stride) noexcept;
+
+  double* Data() const noexcept { return const_cast<double*>(data_); }
+
+  double& operator()(int row, int col) const;
+  S21MatrixView T() const noexcept;
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+
+  void Assign(const S21ConstMatrixView& other) const;
+  void SumMatrix(const S21ConstMatrixView& other) const;
+  void SubMatrix(const S21ConstMatrixView& other) const;
+  void MulNumber(double num) const;
+  // Adds alpha * left * right to the viewed elements. An operand that
+  // overlaps the view is multiplied into a temporary first.
+  void AddProduct(const S21ConstMatrixView& left,
+                  const S21ConstMatrixView& right, double alpha = 1.0) const;
+
+ private:
+  double* MutableAddress(int row, int col) const noexcept {
+    return const_cast<double*>(Address(row, col));
+  }
+  template <typename Operation>
+  void Update(const S21ConstMatrixView& other, Operation operation) const;
+};
+
+S21Matrix operator*(const S21ConstMatrixView& left,
+                    const S21ConstMatrixView& right);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_MATRIX_VIEW_H_
@@ -0,0 +1,304 @@
+#include "s21_out_of_core.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "s21_simd.h"
+
+namespace {
+
+int CeilDiv(int value, int divisor) { return (value + divisor - 1) / divisor; }
+
+// One background thread that runs load(step, step % 2) for each requested
+// step in turn. An exception thrown by load is rethrown by Wait.
+template <typename Load>
+class Prefetcher {
+ public:
+  explicit Prefetcher(const Load& load)
+      : load_(load),
+        requested_(-1),
+        loaded_(-1),
+        stopping_(false),
+        thread_([this] { Run(); }) {}
+  Prefetcher(const Prefetcher&) = delete;
+  Prefetcher& operator=(const Prefetcher&) = delete;
+  ~Prefetcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+  }
+
+  void Request(int step) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      requested_ = step;
+    }
+    condition_.notify_all();
+  }
+
+  void Wait(int step) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this, step] { return loaded_ == step; });
+    if (error_) std::rethrow_exception(error_);
+  }
+
+ private:
+  void Run() {
+    for (;;) {
+      int step;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(
+            lock, [this] { return stopping_ || requested_ != loaded_; });
+        if (stopping_) return;
+        step = requested_;
+      }
+      std::exception_ptr error;
+      try {
+        load_(step, step % 2);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = error;
+        loaded_ = step;
+      }
+      condition_.notify_all();
+    }
+  }
+
+  const Load& load_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  int requested_;
+  int loaded_;
+  bool stopping_;
+  std::exception_ptr error_;
+  std::thread thread_;
+};
+
+// Loads the tiles of each step one step ahead of process(step, slot);
+// consecutive steps alternate between buffer slots 0 and 1, so a slot is
+// never loaded while it is being processed.
+template <typename Load, typename Process>
+void RunPipeline(int steps, const Load& load, const Process& process) {
+  if (steps == 0) return;
+  Prefetcher<Load> prefetcher(load);
+  prefetcher.Request(0);
+  for (int step = 0; step < steps; step++) {
+    prefetcher.Wait(step);
+    if (step + 1 < steps) prefetcher.Request(step + 1);
+    process(step, step % 2);
+  }
+}
+
+void CheckOutputIsNotInput(const std::string& path, const S21FileMatrix& left,
+                           const S21FileMatrix& right) {
+  if (left.IsStoredAt(path) || right.IsStoredAt(path))
+    throw std::logic_error("The output file is one of the input files");
+}
+
+// The index-th block, in row-major order, of a rows x cols matrix cut into
+// blocks of block_rows x block_cols; blocks on the edges may be smaller.
+struct Block {
+  int row, col, rows, cols;
+};
+
+Block BlockAt(int index, int block_rows, int block_cols, int rows, int cols) {
+  int per_row = CeilDiv(cols, block_cols);
+  Block block;
+  block.row = index / per_row * block_rows;
+  block.col = index % per_row * block_cols;
+  block.rows = std::min(block_rows, rows - block.row);
+  block.cols = std::min(block_cols, cols - block.col);
+  return block;
+}
+
+int BlockCount(int block_rows, int block_cols, int rows, int cols) {
+  return CeilDiv(rows, block_rows) * CeilDiv(cols, block_cols);
+}
+
+std::uint64_t BlockBytes(int rows, int cols) {
+  return static_cast<std::uint64_t>(rows) * cols * sizeof(double);
+}
+
+}  // namespace
+
+S21OutOfCore::S21OutOfCore(std::size_t memory_budget)
+    : memory_budget_(memory_budget), stats_() {}
+
+std::size_t S21OutOfCore::GetMemoryBudget() const noexcept {
+  return memory_budget_;
+}
+
+void S21OutOfCore::SetMemoryBudget(std::size_t memory_budget) {
+  memory_budget_ = memory_budget;
+}
+
+const S21OutOfCoreStats& S21OutOfCore::GetStats() const noexcept {
+  return stats_;
+}
+
+void S21OutOfCore::ResetStats() noexcept { stats_ = S21OutOfCoreStats(); }
+
+S21FileMatrix S21OutOfCore::Multiply(const S21FileMatrix& left,
+                                     const S21FileMatrix& right,
+                                     const std::string& path) {
+  if (left.GetCols() != right.GetRows())
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+
+  int tile = SquareTileSize(5);
+  int rows = left.GetRows(), inner = left.GetCols(), cols = right.GetCols();
+  int tile_rows = std::min(tile, rows), tile_inner = std::min(tile, inner);
+  int tile_cols = std::min(tile, cols);
+  std::size_t buffer_bytes = 0;
+  S21Matrix left_tiles[2] = {
+      AllocateBuffer(tile_rows, tile_inner, buffer_bytes),
+      AllocateBuffer(tile_rows, tile_inner, buffer_bytes)};
+  S21Matrix right_tiles[2] = {
+      AllocateBuffer(tile_inner, tile_cols, buffer_bytes),
+      AllocateBuffer(tile_inner, tile_cols, buffer_bytes)};
+  S21Matrix product = AllocateBuffer(tile_rows, tile_cols, buffer_bytes);
+
+  CheckOutputIsNotInput(path, left, right);
+  S21FileMatrix result = S21FileMatrix::Create(path, rows, cols);
+  // Step s multiplies block (i, k) of left by block (k, j) of right, with k
+  // varying fastest so that each product block is finished before the next.
+  int inner_steps = CeilDiv(inner, tile);
+  auto output_block = [&](int step) {
+    return BlockAt(step / inner_steps, tile, tile, rows, cols);
+  };
+  auto inner_block = [&](int step) {
+    return BlockAt(step % inner_steps, 1, tile, 1, inner);
+  };
+
+  RunPipeline(
+      BlockCount(tile, tile, rows, cols) * inner_steps,
+      [&](int step, int slot) {
+        Block out = output_block(step), k = inner_block(step);
+        left.ReadBlock(out.row, k.col,
+                       left_tiles[slot].Block(0, 0, out.rows, k.cols));
+        right.ReadBlock(k.col, out.col,
+                        right_tiles[slot].Block(0, 0, k.cols, out.cols));
+      },
+      [&](int step, int slot) {
+        Block out = output_block(step), k = inner_block(step);
+        stats_.bytes_read +=
+            BlockBytes(out.rows, k.cols) + BlockBytes(k.cols, out.cols);
+        S21MatrixView target = product.Block(0, 0, out.rows, out.cols);
+        if (k.col == 0) {
+          for (int i = 0; i < out.rows; i++) {
+            double* row = target.Data() + i * target.GetRowStride();
+            std::fill(row, row + out.cols, 0.0);
+          }
+        }
+        target.AddProduct(left_tiles[slot].Block(0, 0, out.rows, k.cols),
+                          right_tiles[slot].Block(0, 0, k.cols, out.cols));
+        if (k.col + k.cols == inner) {
+          result.WriteBlock(out.row, out.col, target);
+          stats_.bytes_written += BlockBytes(out.rows, out.cols);
+        }
+      });
+  return result;
+}
+
+S21FileMatrix S21OutOfCore::Transpose(const S21FileMatrix& matrix,
+                                      const std::string& path) {
+  int tile = SquareTileSize(3);
+  int rows = matrix.GetRows(), cols = matrix.GetCols();
+  int tile_rows = std::min(tile, rows), tile_cols = std::min(tile, cols);
+  std::size_t buffer_bytes = 0;
+  S21Matrix tiles[2] = {AllocateBuffer(tile_rows, tile_cols, buffer_bytes),
+                        AllocateBuffer(tile_rows, tile_cols, buffer_bytes)};
+  S21Matrix transposed = AllocateBuffer(tile_cols, tile_rows, buffer_bytes);
+
+  CheckOutputIsNotInput(path, matrix, matrix);
+  S21FileMatrix result = S21FileMatrix::Create(path, cols, rows);
+  RunPipeline(
+      BlockCount(tile, tile, rows, cols),
+      [&](int step, int slot) {
+        Block block = BlockAt(step, tile, tile, rows, cols);
+        matrix.ReadBlock(block.row, block.col,
+                         tiles[slot].Block(0, 0, block.rows, block.cols));
+      },
+      [&](int step, int slot) {
+        Block block = BlockAt(step, tile, tile, rows, cols);
+        stats_.bytes_read += BlockBytes(block.rows, block.cols);
+        S21ConstMatrixView source =
+            tiles[slot].Block(0, 0, block.rows, block.cols);
+        S21MatrixView target = transposed.Block(0, 0, block.cols, block.rows);
+        S21SimdTranspose(block.rows, block.cols, source.Data(),
+                         source.GetRowStride(), target.Data(),
+                         target.GetRowStride());
+        result.WriteBlock(block.col, block.row, target);
+        stats_.bytes_written += BlockBytes(block.cols, block.rows);
+      });
+  return result;
+}
+
+S21FileMatrix S21OutOfCore::Add(const S21FileMatrix& left,
+                                const S21FileMatrix& right,
+                                const std::string& path) {
+  if (left.GetRows() != right.GetRows() || left.GetCols() != right.GetCols())
+    throw std::logic_error("Matrices must have the same dimensions");
+
+  // Whole rows are preferred: a full-width block is one contiguous read.
+  int rows = left.GetRows(), cols = left.GetCols();
+  std::size_t elements = memory_budget_ / sizeof(double) / 4;
+  int width = static_cast<int>(std::min<std::size_t>(cols, elements));
+  if (width == 0) throw std::logic_error("The memory budget is too small");
+  int height = static_cast<int>(std::min<std::size_t>(rows, elements / width));
+  std::size_t buffer_bytes = 0;
+  S21Matrix left_tiles[2] = {AllocateBuffer(height, width, buffer_bytes),
+                             AllocateBuffer(height, width, buffer_bytes)};
+  S21Matrix right_tiles[2] = {AllocateBuffer(height, width, buffer_bytes),
+                              AllocateBuffer(height, width, buffer_bytes)};
+
+  CheckOutputIsNotInput(path, left, right);
+  S21FileMatrix result = S21FileMatrix::Create(path, rows, cols);
+  RunPipeline(
+      BlockCount(height, width, rows, cols),
+      [&](int step, int slot) {
+        Block block = BlockAt(step, height, width, rows, cols);
+        left.ReadBlock(block.row, block.col,
+                       left_tiles[slot].Block(0, 0, block.rows, block.cols));
+        right.ReadBlock(block.row, block.col,
+                        right_tiles[slot].Block(0, 0, block.rows, block.cols));
+      },
+      [&](int step, int slot) {
+        Block block = BlockAt(step, height, width, rows, cols);
+        stats_.bytes_read += 2 * BlockBytes(block.rows, block.cols);
+        S21MatrixView sum =
+            left_tiles[slot].Block(0, 0, block.rows, block.cols);
+        sum.SumMatrix(right_tiles[slot].Block(0, 0, block.rows, block.cols));
+        result.WriteBlock(block.row, block.col, sum);
+        stats_.bytes_written += BlockBytes(block.rows, block.cols);
+      });
+  return result;
+}
+
+int S21OutOfCore::SquareTileSize(int buffers) const {
+  std::size_t elements = memory_budget_ / sizeof(double) / buffers;
+  int tile = static_cast<int>(std::sqrt(static_cast<double>(elements)));
+  while (tile > 0 && static_cast<std::size_t>(tile) * tile > elements) tile--;
+  if (tile == 0) throw std::logic_error("The memory budget is too small");
+  return tile;
+}
+
+S21Matrix S21OutOfCore::AllocateBuffer(int rows, int cols,
+                                       std::size_t& buffer_bytes) {
+  buffer_bytes += BlockBytes(rows, cols);
+  stats_.peak_buffer_bytes = std::max(stats_.peak_buffer_bytes, buffer_bytes);
+  return S21Matrix(rows, cols);
+}
@@ -0,0 +1,49 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_OUT_OF_CORE_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_OUT_OF_CORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "s21_matrix_io.h"
+
+struct S21OutOfCoreStats {
+  std::uint64_t bytes_read;
+  std::uint64_t bytes_written;
+  // The most memory held in tile buffers at once.
+  std::size_t peak_buffer_bytes;
+};
+
+// Blocked algorithms over file-backed matrices that keep every tile buffer
+// within a memory budget. Each operation reads the tiles of its next step on
+// a background thread while the current step is computed, so disk reads
+// overlap with arithmetic. Results are written to new matrix files.
+class S21OutOfCore {
+ public:
+  static constexpr std::size_t kDefaultMemoryBudget = std::size_t{256} << 20;
+
+  explicit S21OutOfCore(std::size_t memory_budget = kDefaultMemoryBudget);
+
+  std::size_t GetMemoryBudget() const noexcept;
+  void SetMemoryBudget(std::size_t memory_budget);
+  const S21OutOfCoreStats& GetStats() const noexcept;
+  void ResetStats() noexcept;
+
+  S21FileMatrix Multiply(const S21FileMatrix& left, const S21FileMatrix& right,
+                         const std::string& path);
+  S21FileMatrix Transpose(const S21FileMatrix& matrix,
+                          const std::string& path);
+  S21FileMatrix Add(const S21FileMatrix& left, const S21FileMatrix& right,
+                    const std::string& path);
+
+ private:
+  // The side of the largest square tile such that `buffers` of them fit in
+  // the budget.
+  int SquareTileSize(int buffers) const;
+  S21Matrix AllocateBuffer(int rows, int cols, std::size_t& buffer_bytes);
+
+  std::size_t memory_budget_;
+  S21OutOfCoreStats stats_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_OUT_OF_CORE_H_
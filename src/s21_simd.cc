@@ -0,0 +1,766 @@
+#include "s21_simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define S21_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Transposes recurse until both sides of a block fit in one tile, so a source
+// and a destination tile stay in L1 whatever the matrix size is.
+constexpr int kTransposeTile = 32;
+
+using TransposeTileFunction = void (*)(int, int, const double*, std::ptrdiff_t,
+                                       double*, std::ptrdiff_t);
+
+// The element-wise kernels write dst = first op second (or factor * src);
+// dst may be the same array as an operand, which gives the in-place forms.
+void AddScalar(double* dst, const double* first, const double* second,
+               std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; i++) dst[i] = first[i] + second[i];
+}
+
+void SubScalar(double* dst, const double* first, const double* second,
+               std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; i++) dst[i] = first[i] - second[i];
+}
+
+void ScaleScalar(double* dst, double factor, const double* src,
+                 std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; i++) dst[i] = factor * src[i];
+}
+
+void AxpyScalar(double* dst, double factor, const double* src,
+                std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; i++) dst[i] += factor * src[i];
+}
+
+bool AllCloseScalar(const double* first, const double* second,
+                    std::size_t size, double eps) noexcept {
+  for (std::size_t i = 0; i < size; i++) {
+    if (fabs(first[i] - second[i]) > eps) return false;
+  }
+  return true;
+}
+
+double SumScalar(const double* src, std::size_t size) noexcept {
+  double result = 0;
+  for (std::size_t i = 0; i < size; i++) result += src[i];
+  return result;
+}
+
+double SumAbsScalar(const double* src, std::size_t size) noexcept {
+  double result = 0;
+  for (std::size_t i = 0; i < size; i++) result += fabs(src[i]);
+  return result;
+}
+
+double DotScalar(const double* first, const double* second,
+                 std::size_t size) noexcept {
+  double result = 0;
+  for (std::size_t i = 0; i < size; i++) result += first[i] * second[i];
+  return result;
+}
+
+void AddAbsScalar(double* dst, const double* src, std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; i++) dst[i] += fabs(src[i]);
+}
+
+void TransposeTileScalar(int rows, int cols, const double* src,
+                         std::ptrdiff_t src_stride, double* dst,
+                         std::ptrdiff_t dst_stride) noexcept {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      dst[j * dst_stride + i] = src[i * src_stride + j];
+    }
+  }
+}
+
+#ifdef S21_SIMD_X86
+
+// The AVX kernels hand their remainders to the SSE2 ones, which are compiled
+// without VEX encoding; the upper register halves are cleared before each
+// hand-off, otherwise every legacy SSE instruction after it pays for a state
+// transition.
+
+void AddSse2(double* dst, const double* first, const double* second,
+             std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_add_pd(_mm_loadu_pd(first + i),
+                                      _mm_loadu_pd(second + i)));
+  }
+  AddScalar(dst + i, first + i, second + i, size - i);
+}
+
+void SubSse2(double* dst, const double* first, const double* second,
+             std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_sub_pd(_mm_loadu_pd(first + i),
+                                      _mm_loadu_pd(second + i)));
+  }
+  SubScalar(dst + i, first + i, second + i, size - i);
+}
+
+void ScaleSse2(double* dst, double factor, const double* src,
+               std::size_t size) noexcept {
+  __m128d factors = _mm_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(src + i), factors));
+  }
+  ScaleScalar(dst + i, factor, src + i, size - i);
+}
+
+void AxpySse2(double* dst, double factor, const double* src,
+              std::size_t size) noexcept {
+  __m128d factors = _mm_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d product = _mm_mul_pd(factors, _mm_loadu_pd(src + i));
+    _mm_storeu_pd(dst + i, _mm_add_pd(_mm_loadu_pd(dst + i), product));
+  }
+  AxpyScalar(dst + i, factor, src + i, size - i);
+}
+
+bool AllCloseSse2(const double* first, const double* second, std::size_t size,
+                  double eps) noexcept {
+  __m128d sign_mask = _mm_set1_pd(-0.0);
+  __m128d limit = _mm_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d diff =
+        _mm_sub_pd(_mm_loadu_pd(first + i), _mm_loadu_pd(second + i));
+    __m128d above = _mm_cmpgt_pd(_mm_andnot_pd(sign_mask, diff), limit);
+    if (_mm_movemask_pd(above)) return false;
+  }
+  return AllCloseScalar(first + i, second + i, size - i, eps);
+}
+
+double SumSse2(const double* src, std::size_t size) noexcept {
+  __m128d sum = _mm_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) sum = _mm_add_pd(sum, _mm_loadu_pd(src + i));
+  double lanes[2];
+  _mm_storeu_pd(lanes, sum);
+  return lanes[0] + lanes[1] + SumScalar(src + i, size - i);
+}
+
+double SumAbsSse2(const double* src, std::size_t size) noexcept {
+  __m128d sign_mask = _mm_set1_pd(-0.0);
+  __m128d sum = _mm_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    sum = _mm_add_pd(sum, _mm_andnot_pd(sign_mask, _mm_loadu_pd(src + i)));
+  }
+  double lanes[2];
+  _mm_storeu_pd(lanes, sum);
+  return lanes[0] + lanes[1] + SumAbsScalar(src + i, size - i);
+}
+
+double DotSse2(const double* first, const double* second,
+               std::size_t size) noexcept {
+  __m128d sum = _mm_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    sum = _mm_add_pd(
+        sum, _mm_mul_pd(_mm_loadu_pd(first + i), _mm_loadu_pd(second + i)));
+  }
+  double lanes[2];
+  _mm_storeu_pd(lanes, sum);
+  return lanes[0] + lanes[1] + DotScalar(first + i, second + i, size - i);
+}
+
+void AddAbsSse2(double* dst, const double* src, std::size_t size) noexcept {
+  __m128d sign_mask = _mm_set1_pd(-0.0);
+  std::size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d magnitude = _mm_andnot_pd(sign_mask, _mm_loadu_pd(src + i));
+    _mm_storeu_pd(dst + i, _mm_add_pd(_mm_loadu_pd(dst + i), magnitude));
+  }
+  AddAbsScalar(dst + i, src + i, size - i);
+}
+
+void TransposeTileSse2(int rows, int cols, const double* src,
+                       std::ptrdiff_t src_stride, double* dst,
+                       std::ptrdiff_t dst_stride) noexcept {
+  int i = 0;
+  for (; i + 2 <= rows; i += 2) {
+    const double* row0 = src + i * src_stride;
+    const double* row1 = row0 + src_stride;
+    int j = 0;
+    for (; j + 2 <= cols; j += 2) {
+      __m128d first = _mm_loadu_pd(row0 + j);
+      __m128d second = _mm_loadu_pd(row1 + j);
+      _mm_storeu_pd(dst + j * dst_stride + i, _mm_unpacklo_pd(first, second));
+      _mm_storeu_pd(dst + (j + 1) * dst_stride + i,
+                    _mm_unpackhi_pd(first, second));
+    }
+    for (; j < cols; j++) {
+      dst[j * dst_stride + i] = row0[j];
+      dst[j * dst_stride + i + 1] = row1[j];
+    }
+  }
+  TransposeTileScalar(rows - i, cols, src + i * src_stride, src_stride,
+                      dst + i, dst_stride);
+}
+
+__attribute__((target("avx2"))) void AddAvx2(double* dst, const double* first,
+                                             const double* second,
+                                             std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(first + i),
+                                            _mm256_loadu_pd(second + i)));
+  }
+  _mm256_zeroupper();
+  AddSse2(dst + i, first + i, second + i, size - i);
+}
+
+__attribute__((target("avx2"))) void SubAvx2(double* dst, const double* first,
+                                             const double* second,
+                                             std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(dst + i, _mm256_sub_pd(_mm256_loadu_pd(first + i),
+                                            _mm256_loadu_pd(second + i)));
+  }
+  _mm256_zeroupper();
+  SubSse2(dst + i, first + i, second + i, size - i);
+}
+
+__attribute__((target("avx2"))) void ScaleAvx2(double* dst, double factor,
+                                               const double* src,
+                                               std::size_t size) noexcept {
+  __m256d factors = _mm256_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(src + i), factors));
+  }
+  _mm256_zeroupper();
+  ScaleSse2(dst + i, factor, src + i, size - i);
+}
+
+__attribute__((target("avx2,fma"))) void AxpyAvx2(double* dst, double factor,
+                                                  const double* src,
+                                                  std::size_t size) noexcept {
+  __m256d factors = _mm256_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(dst + i, _mm256_fmadd_pd(factors, _mm256_loadu_pd(src + i),
+                                              _mm256_loadu_pd(dst + i)));
+  }
+  _mm256_zeroupper();
+  AxpySse2(dst + i, factor, src + i, size - i);
+}
+
+__attribute__((target("avx2"))) bool AllCloseAvx2(const double* first,
+                                                  const double* second,
+                                                  std::size_t size,
+                                                  double eps) noexcept {
+  __m256d sign_mask = _mm256_set1_pd(-0.0);
+  __m256d limit = _mm256_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(first + i), _mm256_loadu_pd(second + i));
+    __m256d above =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign_mask, diff), limit, _CMP_GT_OQ);
+    if (_mm256_movemask_pd(above)) return false;
+  }
+  _mm256_zeroupper();
+  return AllCloseSse2(first + i, second + i, size - i, eps);
+}
+
+inline __attribute__((target("avx2"), always_inline)) double HorizontalSumAvx2(
+    const __m256d& sum) noexcept {
+  double lanes[4];
+  _mm256_storeu_pd(lanes, sum);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+__attribute__((target("avx2"))) double SumAvx2(const double* src,
+                                               std::size_t size) noexcept {
+  __m256d sum = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum = _mm256_add_pd(sum, _mm256_loadu_pd(src + i));
+  }
+  double total = HorizontalSumAvx2(sum);
+  _mm256_zeroupper();
+  return total + SumSse2(src + i, size - i);
+}
+
+__attribute__((target("avx2"))) double SumAbsAvx2(const double* src,
+                                                  std::size_t size) noexcept {
+  __m256d sign_mask = _mm256_set1_pd(-0.0);
+  __m256d sum = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum = _mm256_add_pd(sum,
+                        _mm256_andnot_pd(sign_mask, _mm256_loadu_pd(src + i)));
+  }
+  double total = HorizontalSumAvx2(sum);
+  _mm256_zeroupper();
+  return total + SumAbsSse2(src + i, size - i);
+}
+
+__attribute__((target("avx2,fma"))) double DotAvx2(const double* first,
+                                                   const double* second,
+                                                   std::size_t size) noexcept {
+  __m256d sum = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum = _mm256_fmadd_pd(_mm256_loadu_pd(first + i),
+                          _mm256_loadu_pd(second + i), sum);
+  }
+  double total = HorizontalSumAvx2(sum);
+  _mm256_zeroupper();
+  return total + DotSse2(first + i, second + i, size - i);
+}
+
+__attribute__((target("avx2"))) void AddAbsAvx2(double* dst, const double* src,
+                                                std::size_t size) noexcept {
+  __m256d sign_mask = _mm256_set1_pd(-0.0);
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d magnitude = _mm256_andnot_pd(sign_mask, _mm256_loadu_pd(src + i));
+    _mm256_storeu_pd(dst + i,
+                     _mm256_add_pd(_mm256_loadu_pd(dst + i), magnitude));
+  }
+  _mm256_zeroupper();
+  AddAbsSse2(dst + i, src + i, size - i);
+}
+
+__attribute__((target("avx2"))) void TransposeTileAvx2(
+    int rows, int cols, const double* src, std::ptrdiff_t src_stride,
+    double* dst, std::ptrdiff_t dst_stride) noexcept {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const double* row = src + i * src_stride;
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      __m256d row0 = _mm256_loadu_pd(row + j);
+      __m256d row1 = _mm256_loadu_pd(row + src_stride + j);
+      __m256d row2 = _mm256_loadu_pd(row + 2 * src_stride + j);
+      __m256d row3 = _mm256_loadu_pd(row + 3 * src_stride + j);
+      __m256d low01 = _mm256_unpacklo_pd(row0, row1);
+      __m256d high01 = _mm256_unpackhi_pd(row0, row1);
+      __m256d low23 = _mm256_unpacklo_pd(row2, row3);
+      __m256d high23 = _mm256_unpackhi_pd(row2, row3);
+      double* column = dst + j * dst_stride + i;
+      _mm256_storeu_pd(column, _mm256_permute2f128_pd(low01, low23, 0x20));
+      _mm256_storeu_pd(column + dst_stride,
+                       _mm256_permute2f128_pd(high01, high23, 0x20));
+      _mm256_storeu_pd(column + 2 * dst_stride,
+                       _mm256_permute2f128_pd(low01, low23, 0x31));
+      _mm256_storeu_pd(column + 3 * dst_stride,
+                       _mm256_permute2f128_pd(high01, high23, 0x31));
+    }
+    for (; j < cols; j++) {
+      for (int k = 0; k < 4; k++) {
+        dst[j * dst_stride + i + k] = row[k * src_stride + j];
+      }
+    }
+  }
+  _mm256_zeroupper();
+  TransposeTileSse2(rows - i, cols, src + i * src_stride, src_stride, dst + i,
+                    dst_stride);
+}
+
+__attribute__((target("avx512f"))) void AddAvx512(
+    double* dst, const double* first, const double* second,
+    std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(first + i),
+                                            _mm512_loadu_pd(second + i)));
+  }
+  AddAvx2(dst + i, first + i, second + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void SubAvx512(
+    double* dst, const double* first, const double* second,
+    std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_sub_pd(_mm512_loadu_pd(first + i),
+                                            _mm512_loadu_pd(second + i)));
+  }
+  SubAvx2(dst + i, first + i, second + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(
+    double* dst, double factor, const double* src, std::size_t size) noexcept {
+  __m512d factors = _mm512_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_mul_pd(_mm512_loadu_pd(src + i), factors));
+  }
+  ScaleAvx2(dst + i, factor, src + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void AxpyAvx512(
+    double* dst, double factor, const double* src, std::size_t size) noexcept {
+  __m512d factors = _mm512_set1_pd(factor);
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_fmadd_pd(factors, _mm512_loadu_pd(src + i),
+                                              _mm512_loadu_pd(dst + i)));
+  }
+  AxpyAvx2(dst + i, factor, src + i, size - i);
+}
+
+__attribute__((target("avx512f"))) bool AllCloseAvx512(const double* first,
+                                                      const double* second,
+                                                      std::size_t size,
+                                                      double eps) noexcept {
+  __m512d limit = _mm512_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(first + i), _mm512_loadu_pd(second + i));
+    if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), limit, _CMP_GT_OQ)) {
+      return false;
+    }
+  }
+  return AllCloseAvx2(first + i, second + i, size - i, eps);
+}
+
+// Folds the upper half onto the lower one. The masked extracts take an
+// explicit source: the unmasked ones start from an undefined register,
+// which GCC 12 reports under -Wuninitialized once optimization is on.
+inline __attribute__((target("avx512f"), always_inline)) double
+HorizontalSumAvx512(const __m512d& sum) noexcept {
+  __m256d zero = _mm256_setzero_pd();
+  return HorizontalSumAvx2(
+      _mm256_add_pd(_mm512_mask_extractf64x4_pd(zero, 0xff, sum, 0),
+                    _mm512_mask_extractf64x4_pd(zero, 0xff, sum, 1)));
+}
+
+__attribute__((target("avx512f"))) double SumAvx512(
+    const double* src, std::size_t size) noexcept {
+  __m512d sum = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    sum = _mm512_add_pd(sum, _mm512_loadu_pd(src + i));
+  }
+  return HorizontalSumAvx512(sum) + SumAvx2(src + i, size - i);
+}
+
+__attribute__((target("avx512f"))) double SumAbsAvx512(
+    const double* src, std::size_t size) noexcept {
+  __m512d sum = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    sum = _mm512_add_pd(sum, _mm512_abs_pd(_mm512_loadu_pd(src + i)));
+  }
+  return HorizontalSumAvx512(sum) + SumAbsAvx2(src + i, size - i);
+}
+
+__attribute__((target("avx512f"))) double DotAvx512(
+    const double* first, const double* second, std::size_t size) noexcept {
+  __m512d sum = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    sum = _mm512_fmadd_pd(_mm512_loadu_pd(first + i),
+                          _mm512_loadu_pd(second + i), sum);
+  }
+  return HorizontalSumAvx512(sum) + DotAvx2(first + i, second + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void AddAbsAvx512(
+    double* dst, const double* src, std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512d magnitude = _mm512_abs_pd(_mm512_loadu_pd(src + i));
+    _mm512_storeu_pd(dst + i,
+                     _mm512_add_pd(_mm512_loadu_pd(dst + i), magnitude));
+  }
+  AddAbsAvx2(dst + i, src + i, size - i);
+}
+
+#endif
+
+S21SimdLevel DetectSimdLevel() noexcept {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return S21SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return S21SimdLevel::kAvx2;
+  }
+  return S21SimdLevel::kSse2;
+#else
+  return S21SimdLevel::kScalar;
+#endif
+}
+
+TransposeTileFunction SelectTransposeTile() noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+    case S21SimdLevel::kAvx2:
+      return TransposeTileAvx2;
+    case S21SimdLevel::kSse2:
+      return TransposeTileSse2;
+#endif
+    default:
+      return TransposeTileScalar;
+  }
+}
+
+// Splits so that the first part stays a multiple of 4 and the in-register
+// kernels only meet ragged edges at the border of the whole matrix.
+int SplitPoint(int extent) { return (extent / 2 + 3) & ~3; }
+
+void TransposeRecursive(int rows, int cols, const double* src,
+                        std::ptrdiff_t src_stride, double* dst,
+                        std::ptrdiff_t dst_stride,
+                        TransposeTileFunction tile) noexcept {
+  if (rows <= kTransposeTile && cols <= kTransposeTile) {
+    tile(rows, cols, src, src_stride, dst, dst_stride);
+  } else if (rows >= cols) {
+    int half = SplitPoint(rows);
+    TransposeRecursive(half, cols, src, src_stride, dst, dst_stride, tile);
+    TransposeRecursive(rows - half, cols, src + half * src_stride, src_stride,
+                       dst + half, dst_stride, tile);
+  } else {
+    int half = SplitPoint(cols);
+    TransposeRecursive(rows, half, src, src_stride, dst, dst_stride, tile);
+    TransposeRecursive(rows, cols - half, src + half, src_stride,
+                       dst + half * dst_stride, dst_stride, tile);
+  }
+}
+
+// Exchanges the rows x cols block at first with the transpose of the
+// cols x rows block at second. Leaves go through a tile-sized buffer so the
+// out-of-place kernel does the shuffling.
+void TransposeSwapRecursive(int rows, int cols, double* first,
+                            double* second, std::ptrdiff_t stride,
+                            TransposeTileFunction tile) noexcept {
+  if (rows <= kTransposeTile && cols <= kTransposeTile) {
+    double buffer[kTransposeTile * kTransposeTile];
+    for (int i = 0; i < rows; i++) {
+      std::copy(first + i * stride, first + i * stride + cols,
+                buffer + i * kTransposeTile);
+    }
+    tile(cols, rows, second, stride, first, stride);
+    tile(rows, cols, buffer, kTransposeTile, second, stride);
+  } else if (rows >= cols) {
+    int half = SplitPoint(rows);
+    TransposeSwapRecursive(half, cols, first, second, stride, tile);
+    TransposeSwapRecursive(rows - half, cols, first + half * stride,
+                           second + half, stride, tile);
+  } else {
+    int half = SplitPoint(cols);
+    TransposeSwapRecursive(rows, half, first, second, stride, tile);
+    TransposeSwapRecursive(rows, cols - half, first + half,
+                           second + half * stride, stride, tile);
+  }
+}
+
+void TransposeInPlaceRecursive(int size, double* data, std::ptrdiff_t stride,
+                               TransposeTileFunction tile) noexcept {
+  if (size <= kTransposeTile) {
+    double buffer[kTransposeTile * kTransposeTile];
+    for (int i = 0; i < size; i++) {
+      std::copy(data + i * stride, data + i * stride + size,
+                buffer + i * kTransposeTile);
+    }
+    tile(size, size, buffer, kTransposeTile, data, stride);
+    return;
+  }
+  int half = SplitPoint(size);
+  TransposeInPlaceRecursive(half, data, stride, tile);
+  TransposeInPlaceRecursive(size - half, data + half * stride + half, stride,
+                            tile);
+  TransposeSwapRecursive(half, size - half, data + half, data + half * stride,
+                         stride, tile);
+}
+
+const S21SimdLevel kSupportedLevel = DetectSimdLevel();
+std::atomic<S21SimdLevel> active_level(kSupportedLevel);
+
+}  // namespace
+
+S21SimdLevel S21GetSimdLevel() noexcept {
+  return active_level.load(std::memory_order_relaxed);
+}
+
+S21SimdLevel S21GetSupportedSimdLevel() noexcept { return kSupportedLevel; }
+
+void S21SetSimdLevel(S21SimdLevel level) noexcept {
+  active_level = level < kSupportedLevel ? level : kSupportedLevel;
+}
+
+void S21SimdAdd(double* dst, const double* src, std::size_t size) noexcept {
+  S21SimdAddInto(dst, dst, src, size);
+}
+
+void S21SimdSub(double* dst, const double* src, std::size_t size) noexcept {
+  S21SimdSubInto(dst, dst, src, size);
+}
+
+void S21SimdScale(double* dst, double factor, std::size_t size) noexcept {
+  S21SimdScaleInto(dst, factor, dst, size);
+}
+
+void S21SimdAddInto(double* dst, const double* first, const double* second,
+                    std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return AddAvx512(dst, first, second, size);
+    case S21SimdLevel::kAvx2:
+      return AddAvx2(dst, first, second, size);
+    case S21SimdLevel::kSse2:
+      return AddSse2(dst, first, second, size);
+#endif
+    default:
+      return AddScalar(dst, first, second, size);
+  }
+}
+
+void S21SimdSubInto(double* dst, const double* first, const double* second,
+                    std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return SubAvx512(dst, first, second, size);
+    case S21SimdLevel::kAvx2:
+      return SubAvx2(dst, first, second, size);
+    case S21SimdLevel::kSse2:
+      return SubSse2(dst, first, second, size);
+#endif
+    default:
+      return SubScalar(dst, first, second, size);
+  }
+}
+
+void S21SimdScaleInto(double* dst, double factor, const double* src,
+                      std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return ScaleAvx512(dst, factor, src, size);
+    case S21SimdLevel::kAvx2:
+      return ScaleAvx2(dst, factor, src, size);
+    case S21SimdLevel::kSse2:
+      return ScaleSse2(dst, factor, src, size);
+#endif
+    default:
+      return ScaleScalar(dst, factor, src, size);
+  }
+}
+
+void S21SimdAxpy(double* dst, double factor, const double* src,
+                 std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return AxpyAvx512(dst, factor, src, size);
+    case S21SimdLevel::kAvx2:
+      return AxpyAvx2(dst, factor, src, size);
+    case S21SimdLevel::kSse2:
+      return AxpySse2(dst, factor, src, size);
+#endif
+    default:
+      return AxpyScalar(dst, factor, src, size);
+  }
+}
+
+bool S21SimdAllClose(const double* first, const double* second,
+                     std::size_t size, double eps) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return AllCloseAvx512(first, second, size, eps);
+    case S21SimdLevel::kAvx2:
+      return AllCloseAvx2(first, second, size, eps);
+    case S21SimdLevel::kSse2:
+      return AllCloseSse2(first, second, size, eps);
+#endif
+    default:
+      return AllCloseScalar(first, second, size, eps);
+  }
+}
+
+double S21SimdSum(const double* src, std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return SumAvx512(src, size);
+    case S21SimdLevel::kAvx2:
+      return SumAvx2(src, size);
+    case S21SimdLevel::kSse2:
+      return SumSse2(src, size);
+#endif
+    default:
+      return SumScalar(src, size);
+  }
+}
+
+double S21SimdSumAbs(const double* src, std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return SumAbsAvx512(src, size);
+    case S21SimdLevel::kAvx2:
+      return SumAbsAvx2(src, size);
+    case S21SimdLevel::kSse2:
+      return SumAbsSse2(src, size);
+#endif
+    default:
+      return SumAbsScalar(src, size);
+  }
+}
+
+double S21SimdDot(const double* first, const double* second,
+                  std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return DotAvx512(first, second, size);
+    case S21SimdLevel::kAvx2:
+      return DotAvx2(first, second, size);
+    case S21SimdLevel::kSse2:
+      return DotSse2(first, second, size);
+#endif
+    default:
+      return DotScalar(first, second, size);
+  }
+}
+
+void S21SimdAddAbs(double* dst, const double* src,
+                    std::size_t size) noexcept {
+  switch (S21GetSimdLevel()) {
+#ifdef S21_SIMD_X86
+    case S21SimdLevel::kAvx512:
+      return AddAbsAvx512(dst, src, size);
+    case S21SimdLevel::kAvx2:
+      return AddAbsAvx2(dst, src, size);
+    case S21SimdLevel::kSse2:
+      return AddAbsSse2(dst, src, size);
+#endif
+    default:
+      return AddAbsScalar(dst, src, size);
+  }
+}
+
+void S21SimdTranspose(int rows, int cols, const double* src,
+                      std::ptrdiff_t src_stride, double* dst,
+                      std::ptrdiff_t dst_stride) noexcept {
+  TransposeRecursive(rows, cols, src, src_stride, dst, dst_stride,
+                     SelectTransposeTile());
+}
+
+void S21SimdTransposeInPlace(int size, double* data,
+                             std::ptrdiff_t stride) noexcept {
+  TransposeInPlaceRecursive(size, data, stride, SelectTransposeTile());
+}
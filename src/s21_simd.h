@@ -0,0 +1,50 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_SIMD_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_SIMD_H_
+
+#include <cstddef>
+
+enum class S21SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+// Matrix buffers, owned or from an S21MatrixArena, start on this boundary: a
+// cache line, and the width of an AVX-512 vector.
+constexpr std::size_t kS21SimdAlignment = 64;
+
+// The widest instruction set supported by the CPU is detected once at startup.
+// S21SetSimdLevel can lower it (for example to test or benchmark the narrower
+// kernels); requests above what the CPU supports are clamped.
+S21SimdLevel S21GetSimdLevel() noexcept;
+S21SimdLevel S21GetSupportedSimdLevel() noexcept;
+void S21SetSimdLevel(S21SimdLevel level) noexcept;
+
+void S21SimdAdd(double* dst, const double* src, std::size_t size) noexcept;
+void S21SimdSub(double* dst, const double* src, std::size_t size) noexcept;
+void S21SimdScale(double* dst, double factor, std::size_t size) noexcept;
+// dst = first + second, first - second and factor * src; dst may be one of
+// the operands.
+void S21SimdAddInto(double* dst, const double* first, const double* second,
+                    std::size_t size) noexcept;
+void S21SimdSubInto(double* dst, const double* first, const double* second,
+                    std::size_t size) noexcept;
+void S21SimdScaleInto(double* dst, double factor, const double* src,
+                      std::size_t size) noexcept;
+// dst += factor * src.
+void S21SimdAxpy(double* dst, double factor, const double* src,
+                 std::size_t size) noexcept;
+bool S21SimdAllClose(const double* first, const double* second,
+                     std::size_t size, double eps) noexcept;
+double S21SimdSum(const double* src, std::size_t size) noexcept;
+double S21SimdSumAbs(const double* src, std::size_t size) noexcept;
+double S21SimdDot(const double* first, const double* second,
+                  std::size_t size) noexcept;
+// dst += |src|.
+void S21SimdAddAbs(double* dst, const double* src, std::size_t size) noexcept;
+
+// Writes the transpose of the rows x cols block at src into dst, which must
+// not overlap src. Strides are in elements between consecutive rows.
+void S21SimdTranspose(int rows, int cols, const double* src,
+                      std::ptrdiff_t src_stride, double* dst,
+                      std::ptrdiff_t dst_stride) noexcept;
+void S21SimdTransposeInPlace(int size, double* data,
+                             std::ptrdiff_t stride) noexcept;
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_SIMD_H_
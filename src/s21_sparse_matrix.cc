@@ -0,0 +1,329 @@
+#include "s21_sparse_matrix.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+constexpr long kParallelWork = 1 << 16;
+constexpr int kChunksPerThread = 4;
+
+}  // namespace
+
+template <typename Operation>
+void S21SparseMatrix::Merge(const S21SparseMatrix& other,
+                            Operation operation) {
+  CheckMatricesHaveSameDimensions(other);
+
+  std::vector<int> row_offsets(rows_ + 1, 0);
+  std::vector<int> col_indices;
+  std::vector<double> values;
+  col_indices.reserve(values_.size() + other.values_.size());
+  values.reserve(values_.size() + other.values_.size());
+  for (int i = 0; i < rows_; i++) {
+    int k = row_offsets_[i], k_end = row_offsets_[i + 1];
+    int l = other.row_offsets_[i], l_end = other.row_offsets_[i + 1];
+    while (k < k_end || l < l_end) {
+      bool take_left = k < k_end;
+      bool take_right = l < l_end;
+      if (take_left && take_right) {
+        take_left = col_indices_[k] <= other.col_indices_[l];
+        take_right = other.col_indices_[l] <= col_indices_[k];
+      }
+      int col = take_left ? col_indices_[k] : other.col_indices_[l];
+      double value = operation(take_left ? values_[k++] : 0.0,
+                               take_right ? other.values_[l++] : 0.0);
+      if (value != 0) {
+        col_indices.push_back(col);
+        values.push_back(value);
+      }
+    }
+    row_offsets[i + 1] = static_cast<int>(values.size());
+  }
+
+  row_offsets_ = std::move(row_offsets);
+  col_indices_ = std::move(col_indices);
+  values_ = std::move(values);
+}
+
+// Splits the rows into chunks holding about the same number of non-zeros and
+// runs them on the global pool once there is enough work to pay for it.
+template <typename Task>
+void S21SparseMatrix::ForRowChunks(long work, const Task& task) const {
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int threads = pool.GetThreadCount();
+  if (threads <= 1 || work < kParallelWork || rows_ < 2) {
+    task(0, rows_);
+    return;
+  }
+
+  int chunks = std::min(rows_, threads * kChunksPerThread);
+  std::vector<int> bounds(chunks + 1, rows_);
+  long non_zeros = GetNonZeros();
+  for (int c = 0; c < chunks; c++) {
+    int target = static_cast<int>(non_zeros * c / chunks);
+    auto first_row = std::lower_bound(row_offsets_.begin(),
+                                      row_offsets_.end() - 1, target);
+    bounds[c] = static_cast<int>(first_row - row_offsets_.begin());
+  }
+  pool.ParallelFor(chunks, [&](int c) {
+    if (bounds[c] < bounds[c + 1]) task(bounds[c], bounds[c + 1]);
+  });
+}
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  CheckRowsAndColsArePositive();
+  row_offsets_.assign(rows_ + 1, 0);
+}
+
+S21SparseMatrix::S21SparseMatrix(const S21Matrix& dense, double tolerance)
+    : rows_(dense.GetRows()), cols_(dense.GetCols()) {
+  S21ConstMatrixView view(dense);
+  row_offsets_.reserve(rows_ + 1);
+  row_offsets_.push_back(0);
+  for (int i = 0; i < rows_; i++) {
+    const double* row = view.Data() + i * view.GetRowStride();
+    for (int j = 0; j < cols_; j++) {
+      if (!(fabs(row[j]) <= tolerance)) {
+        col_indices_.push_back(j);
+        values_.push_back(row[j]);
+      }
+    }
+    row_offsets_.push_back(static_cast<int>(values_.size()));
+  }
+}
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols,
+                                 std::vector<int> row_offsets,
+                                 std::vector<int> col_indices,
+                                 std::vector<double> values)
+    : rows_(rows),
+      cols_(cols),
+      row_offsets_(std::move(row_offsets)),
+      col_indices_(std::move(col_indices)),
+      values_(std::move(values)) {
+  CheckRowsAndColsArePositive();
+  CheckStructure();
+}
+
+S21SparseMatrix S21SparseMatrix::FromEntries(
+    int rows, int cols, std::vector<S21SparseEntry> entries) {
+  S21SparseMatrix result(rows, cols);
+  for (const S21SparseEntry& entry : entries) {
+    if (entry.row >= rows || entry.row < 0 || entry.col >= cols ||
+        entry.col < 0)
+      throw std::out_of_range("Index is outside the matrix");
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const S21SparseEntry& left, const S21SparseEntry& right) {
+              return left.row != right.row ? left.row < right.row
+                                           : left.col < right.col;
+            });
+
+  for (std::size_t k = 0; k < entries.size(); k++) {
+    const S21SparseEntry& entry = entries[k];
+    if (k > 0 && entry.row == entries[k - 1].row &&
+        entry.col == entries[k - 1].col) {
+      result.values_.back() += entry.value;
+    } else {
+      result.col_indices_.push_back(entry.col);
+      result.values_.push_back(entry.value);
+      result.row_offsets_[entry.row + 1]++;
+    }
+  }
+  for (int i = 0; i < rows; i++) {
+    result.row_offsets_[i + 1] += result.row_offsets_[i];
+  }
+  return result;
+}
+
+S21Matrix S21SparseMatrix::ToDense() const {
+  S21Matrix result(rows_, cols_);
+  S21MatrixView view(result);
+  for (int i = 0; i < rows_; i++) {
+    double* row = view.Data() + i * view.GetRowStride();
+    for (int k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+      row[col_indices_[k]] = values_[k];
+    }
+  }
+  return result;
+}
+
+int S21SparseMatrix::GetRows() const noexcept { return rows_; }
+
+int S21SparseMatrix::GetCols() const noexcept { return cols_; }
+
+int S21SparseMatrix::GetNonZeros() const noexcept {
+  return static_cast<int>(values_.size());
+}
+
+const std::vector<int>& S21SparseMatrix::GetRowOffsets() const noexcept {
+  return row_offsets_;
+}
+
+const std::vector<int>& S21SparseMatrix::GetColIndices() const noexcept {
+  return col_indices_;
+}
+
+const std::vector<double>& S21SparseMatrix::GetValues() const noexcept {
+  return values_;
+}
+
+double S21SparseMatrix::Get(int row, int col) const {
+  if (row >= rows_ || row < 0 || col >= cols_ || col < 0)
+    throw std::out_of_range("Index is outside the matrix");
+  auto begin = col_indices_.begin() + row_offsets_[row];
+  auto end = col_indices_.begin() + row_offsets_[row + 1];
+  auto found = std::lower_bound(begin, end, col);
+  if (found == end || *found != col) return 0;
+  return values_[found - col_indices_.begin()];
+}
+
+bool S21SparseMatrix::EqMatrix(const S21SparseMatrix& other) const {
+  if (other.rows_ != rows_ || other.cols_ != cols_) return false;
+
+  S21SparseMatrix difference = *this - other;
+  for (double value : difference.values_) {
+    if (fabs(value) > S21_MATRIX_OOP_EPS) return false;
+  }
+  return true;
+}
+
+void S21SparseMatrix::SumMatrix(const S21SparseMatrix& other) {
+  Merge(other, [](double left, double right) { return left + right; });
+}
+
+void S21SparseMatrix::SubMatrix(const S21SparseMatrix& other) {
+  Merge(other, [](double left, double right) { return left - right; });
+}
+
+void S21SparseMatrix::MulNumber(double num) noexcept {
+  for (double& value : values_) value *= num;
+}
+
+S21SparseMatrix S21SparseMatrix::Transpose() const {
+  S21SparseMatrix result(cols_, rows_);
+  for (int col : col_indices_) result.row_offsets_[col + 1]++;
+  for (int j = 0; j < cols_; j++) {
+    result.row_offsets_[j + 1] += result.row_offsets_[j];
+  }
+
+  result.col_indices_.resize(values_.size());
+  result.values_.resize(values_.size());
+  std::vector<int> next(result.row_offsets_.begin(),
+                        result.row_offsets_.end() - 1);
+  for (int i = 0; i < rows_; i++) {
+    for (int k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+      int position = next[col_indices_[k]]++;
+      result.col_indices_[position] = i;
+      result.values_[position] = values_[k];
+    }
+  }
+  return result;
+}
+
+std::vector<double> S21SparseMatrix::MulVector(
+    const std::vector<double>& vector) const {
+  if (static_cast<long>(vector.size()) != cols_)
+    throw std::logic_error(
+        "The size of the vector is not equal to the number of columns of the "
+        "matrix");
+
+  std::vector<double> result(rows_);
+  ForRowChunks(GetNonZeros(), [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      double sum = 0;
+      for (int k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+        sum += values_[k] * vector[col_indices_[k]];
+      }
+      result[i] = sum;
+    }
+  });
+  return result;
+}
+
+S21Matrix S21SparseMatrix::MulDense(const S21ConstMatrixView& dense) const {
+  if (cols_ != dense.GetRows())
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+
+  int cols = dense.GetCols();
+  S21Matrix result(rows_, cols);
+  S21MatrixView target(result);
+  long work = static_cast<long>(GetNonZeros()) * cols;
+  ForRowChunks(work, [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      double* row = target.Data() + i * target.GetRowStride();
+      for (int k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+        const double* source =
+            dense.Data() + col_indices_[k] * dense.GetRowStride();
+        if (dense.GetColStride() == 1) {
+          S21SimdAxpy(row, values_[k], source, cols);
+        } else {
+          for (int j = 0; j < cols; j++) {
+            row[j] += values_[k] * source[j * dense.GetColStride()];
+          }
+        }
+      }
+    }
+  });
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator+(
+    const S21SparseMatrix& other) const {
+  S21SparseMatrix result = *this;
+  result.SumMatrix(other);
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator-(
+    const S21SparseMatrix& other) const {
+  S21SparseMatrix result = *this;
+  result.SubMatrix(other);
+  return result;
+}
+
+S21Matrix S21SparseMatrix::operator*(const S21Matrix& dense) const {
+  return MulDense(dense);
+}
+
+std::vector<double> S21SparseMatrix::operator*(
+    const std::vector<double>& vector) const {
+  return MulVector(vector);
+}
+
+void S21SparseMatrix::CheckRowsAndColsArePositive() const {
+  if (cols_ <= 0 || rows_ <= 0)
+    throw std::logic_error(
+        "Numbers of rows and columns in a matrix must be positive");
+}
+
+void S21SparseMatrix::CheckStructure() const {
+  bool valid = static_cast<long>(row_offsets_.size()) == rows_ + 1L &&
+               row_offsets_.front() == 0 &&
+               static_cast<std::size_t>(row_offsets_.back()) ==
+                   col_indices_.size() &&
+               col_indices_.size() == values_.size();
+  for (int i = 0; valid && i < rows_; i++) {
+    valid = row_offsets_[i] >= 0 && row_offsets_[i] <= row_offsets_[i + 1];
+  }
+  for (int i = 0; valid && i < rows_; i++) {
+    for (int k = row_offsets_[i]; valid && k < row_offsets_[i + 1]; k++) {
+      valid = col_indices_[k] >= 0 && col_indices_[k] < cols_ &&
+              (k == row_offsets_[i] || col_indices_[k - 1] < col_indices_[k]);
+    }
+  }
+  if (!valid) throw std::logic_error("The sparse matrix structure is invalid");
+}
+
+void S21SparseMatrix::CheckMatricesHaveSameDimensions(
+    const S21SparseMatrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::logic_error("Matrices must have the same dimensions");
+}
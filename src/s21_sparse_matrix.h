@@ -0,0 +1,66 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_SPARSE_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_SPARSE_MATRIX_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+struct S21SparseEntry {
+  int row;
+  int col;
+  double value;
+};
+
+// A sparse matrix in compressed sparse row (CSR) form: the non-zeros of row i
+// are values_[row_offsets_[i] .. row_offsets_[i + 1]) with their columns in
+// col_indices_, sorted and without duplicates. The CSR arrays of Transpose()
+// are the compressed sparse column (CSC) arrays of the original matrix.
+class S21SparseMatrix {
+ public:
+  S21SparseMatrix(int rows, int cols);
+  explicit S21SparseMatrix(const S21Matrix& dense, double tolerance = 0.0);
+  S21SparseMatrix(int rows, int cols, std::vector<int> row_offsets,
+                  std::vector<int> col_indices, std::vector<double> values);
+  // Duplicate entries are summed.
+  static S21SparseMatrix FromEntries(int rows, int cols,
+                                     std::vector<S21SparseEntry> entries);
+
+  S21Matrix ToDense() const;
+
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  int GetNonZeros() const noexcept;
+  const std::vector<int>& GetRowOffsets() const noexcept;
+  const std::vector<int>& GetColIndices() const noexcept;
+  const std::vector<double>& GetValues() const noexcept;
+  double Get(int row, int col) const;
+
+  bool EqMatrix(const S21SparseMatrix& other) const;
+  void SumMatrix(const S21SparseMatrix& other);
+  void SubMatrix(const S21SparseMatrix& other);
+  void MulNumber(double num) noexcept;
+  S21SparseMatrix Transpose() const;
+  std::vector<double> MulVector(const std::vector<double>& vector) const;
+  S21Matrix MulDense(const S21ConstMatrixView& dense) const;
+
+  S21SparseMatrix operator+(const S21SparseMatrix& other) const;
+  S21SparseMatrix operator-(const S21SparseMatrix& other) const;
+  S21Matrix operator*(const S21Matrix& dense) const;
+  std::vector<double> operator*(const std::vector<double>& vector) const;
+
+ private:
+  void CheckRowsAndColsArePositive() const;
+  void CheckStructure() const;
+  void CheckMatricesHaveSameDimensions(const S21SparseMatrix& other) const;
+  template <typename Operation>
+  void Merge(const S21SparseMatrix& other, Operation operation);
+  template <typename Task>
+  void ForRowChunks(long work, const Task& task) const;
+
+  int rows_, cols_;
+  std::vector<int> row_offsets_;
+  std::vector<int> col_indices_;
+  std::vector<double> values_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_SPARSE_MATRIX_H_
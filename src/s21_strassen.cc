@@ -0,0 +1,199 @@
+#include "s21_strassen.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include "s21_gemm.h"
+#include "s21_matrix_arena.h"
+#include "s21_simd.h"
+
+namespace {
+
+// out = x + sign * y for rows x cols blocks; out may be x or y.
+void Combine(int rows, int cols, const double* x, std::ptrdiff_t ldx,
+             const double* y, std::ptrdiff_t ldy, double sign, double* out,
+             std::ptrdiff_t ldo) {
+  for (int i = 0; i < rows; i++) {
+    double* target = out + i * ldo;
+    const double* first = x + i * ldx;
+    const double* second = y + i * ldy;
+    if (target == second) {
+      if (sign < 0) S21SimdScale(target, -1.0, cols);
+      S21SimdAdd(target, first, cols);
+      continue;
+    }
+    if (target != first) std::memcpy(target, first, cols * sizeof(double));
+    if (sign > 0) {
+      S21SimdAdd(target, second, cols);
+    } else {
+      S21SimdSub(target, second, cols);
+    }
+  }
+}
+
+void Zero(int rows, int cols, double* c, std::ptrdiff_t ldc) {
+  for (int i = 0; i < rows; i++) std::fill(c + i * ldc, c + i * ldc + cols, 0);
+}
+
+// Quadrant (i, j) of a block whose quadrants are rows x cols.
+const double* Quadrant(const double* data, std::ptrdiff_t ld, int rows,
+                       int cols, int i, int j) {
+  return data + i * rows * ld + j * cols;
+}
+
+double* Quadrant(double* data, std::ptrdiff_t ld, int rows, int cols, int i,
+                 int j) {
+  return data + i * rows * ld + j * cols;
+}
+
+bool IsLeaf(int m, int n, int k, int cutoff) {
+  return m <= cutoff || n <= cutoff || k <= cutoff || m < 2 || n < 2 || k < 2;
+}
+
+// The schedule of Douglas et al. (DGEFMM): three temporaries per level, X for
+// sums of A, Y for sums of B and Z for P1, with everything else accumulated
+// in the quadrants of C.
+void Winograd(int m, int n, int k, const double* a, std::ptrdiff_t lda,
+              const double* b, std::ptrdiff_t ldb, double* c,
+              std::ptrdiff_t ldc, int cutoff, double* work) {
+  if (IsLeaf(m, n, k, cutoff)) {
+    Zero(m, n, c, ldc);
+    S21Gemm(m, n, k, a, lda, 1, b, ldb, 1, c, ldc);
+    return;
+  }
+
+  int m1 = m / 2, n1 = n / 2, k1 = k / 2;
+  const double* a11 = Quadrant(a, lda, m1, k1, 0, 0);
+  const double* a12 = Quadrant(a, lda, m1, k1, 0, 1);
+  const double* a21 = Quadrant(a, lda, m1, k1, 1, 0);
+  const double* a22 = Quadrant(a, lda, m1, k1, 1, 1);
+  const double* b11 = Quadrant(b, ldb, k1, n1, 0, 0);
+  const double* b12 = Quadrant(b, ldb, k1, n1, 0, 1);
+  const double* b21 = Quadrant(b, ldb, k1, n1, 1, 0);
+  const double* b22 = Quadrant(b, ldb, k1, n1, 1, 1);
+  double* c11 = Quadrant(c, ldc, m1, n1, 0, 0);
+  double* c12 = Quadrant(c, ldc, m1, n1, 0, 1);
+  double* c21 = Quadrant(c, ldc, m1, n1, 1, 0);
+  double* c22 = Quadrant(c, ldc, m1, n1, 1, 1);
+  double* x = work;
+  double* y = x + static_cast<std::size_t>(m1) * k1;
+  double* z = y + static_cast<std::size_t>(k1) * n1;
+  double* next = z + static_cast<std::size_t>(m1) * n1;
+  auto multiply = [&](const double* left, std::ptrdiff_t ld_left,
+                      const double* right, std::ptrdiff_t ld_right,
+                      double* target, std::ptrdiff_t ld_target) {
+    Winograd(m1, n1, k1, left, ld_left, right, ld_right, target, ld_target,
+             cutoff, next);
+  };
+
+  Combine(m1, k1, a11, lda, a21, lda, -1, x, k1);  // S3
+  Combine(k1, n1, b22, ldb, b12, ldb, -1, y, n1);  // T3
+  multiply(x, k1, y, n1, c21, ldc);                // P7
+  Combine(m1, k1, a21, lda, a22, lda, 1, x, k1);   // S1
+  Combine(k1, n1, b12, ldb, b11, ldb, -1, y, n1);  // T1
+  multiply(x, k1, y, n1, c22, ldc);                // P5
+  Combine(m1, k1, x, k1, a11, lda, -1, x, k1);     // S2
+  Combine(k1, n1, b22, ldb, y, n1, -1, y, n1);     // T2
+  multiply(x, k1, y, n1, c12, ldc);                // P6
+  Combine(m1, k1, a12, lda, x, k1, -1, x, k1);     // S4
+  multiply(x, k1, b22, ldb, c11, ldc);             // P3
+  multiply(a11, lda, b11, ldb, z, n1);             // P1
+  Combine(m1, n1, c12, ldc, z, n1, 1, c12, ldc);   // U2 = P1 + P6
+  Combine(m1, n1, c21, ldc, c12, ldc, 1, c21, ldc);  // U3 = U2 + P7
+  Combine(m1, n1, c12, ldc, c22, ldc, 1, c12, ldc);  // U4 = U2 + P5
+  Combine(m1, n1, c12, ldc, c11, ldc, 1, c12, ldc);  // U5 = U4 + P3
+  Combine(m1, n1, c22, ldc, c21, ldc, 1, c22, ldc);  // U7 = U3 + P5
+  Combine(k1, n1, y, n1, b21, ldb, -1, y, n1);       // T4
+  multiply(a22, lda, y, n1, c11, ldc);               // P4
+  Combine(m1, n1, c21, ldc, c11, ldc, -1, c21, ldc);  // U6 = U3 - P4
+  multiply(a12, lda, b21, ldb, c11, ldc);             // P2
+  Combine(m1, n1, c11, ldc, z, n1, 1, c11, ldc);      // U1 = P1 + P2
+
+  int m_even = 2 * m1, n_even = 2 * n1, k_even = 2 * k1;
+  if (k_even < k) {
+    S21Gemm(m_even, n_even, 1, a + k_even, lda, 1, b + k_even * ldb, ldb, 1,
+            c, ldc);
+  }
+  if (n_even < n) {
+    Zero(m_even, 1, c + n_even, ldc);
+    S21Gemm(m_even, 1, k, a, lda, 1, b + n_even, ldb, 1, c + n_even, ldc);
+  }
+  if (m_even < m) {
+    Zero(1, n, c + m_even * ldc, ldc);
+    S21Gemm(1, n, k, a + m_even * lda, lda, 1, b, ldb, 1, c + m_even * ldc,
+            ldc);
+  }
+}
+
+class Workspace {
+ public:
+  explicit Workspace(std::size_t size) : arena_(S21MatrixArena::Current()) {
+    if (size == 0) return;
+    if (arena_) {
+      data_ = arena_->Allocate(size);
+    } else {
+      heap_.reset(new double[size]);
+      data_ = heap_.get();
+    }
+  }
+  Workspace(const Workspace&) = delete;
+  Workspace& operator=(const Workspace&) = delete;
+  ~Workspace() {
+    if (arena_ && data_) arena_->Deallocate(data_);
+  }
+
+  double* Get() const noexcept { return data_; }
+
+ private:
+  S21MatrixArena* arena_;
+  std::unique_ptr<double[]> heap_;
+  double* data_ = nullptr;
+};
+
+}  // namespace
+
+void S21StrassenGemm(int m, int n, int k, const double* a, std::ptrdiff_t lda,
+                     const double* b, std::ptrdiff_t ldb, double* c,
+                     std::ptrdiff_t ldc, int cutoff, double* workspace) {
+  if (cutoff <= 0) throw std::logic_error("The cutoff must be positive");
+  if (m <= 0 || n <= 0) return;
+  if (k <= 0) {
+    Zero(m, n, c, ldc);
+    return;
+  }
+  Winograd(m, n, k, a, lda, b, ldb, c, ldc, cutoff, workspace);
+}
+
+std::size_t S21StrassenWorkspaceSize(int m, int n, int k, int cutoff) {
+  if (cutoff <= 0) throw std::logic_error("The cutoff must be positive");
+  std::size_t size = 0;
+  while (!IsLeaf(m, n, k, cutoff)) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    size += static_cast<std::size_t>(m) * k + static_cast<std::size_t>(k) * n +
+            static_cast<std::size_t>(m) * n;
+  }
+  return size;
+}
+
+S21Matrix S21StrassenMultiply(const S21Matrix& left, const S21Matrix& right,
+                              int cutoff) {
+  if (left.GetCols() != right.GetRows())
+    throw std::logic_error(
+        "The number of columns of the first matrix is not equal to the number "
+        "of rows of the second matrix");
+
+  int m = left.GetRows(), n = right.GetCols(), k = left.GetCols();
+  S21Matrix result(m, n);
+  // Allocated after the result so that an arena gets the space back.
+  Workspace workspace(S21StrassenWorkspaceSize(m, n, k, cutoff));
+  S21ConstMatrixView a(left), b(right);
+  S21MatrixView c(result);
+  S21StrassenGemm(m, n, k, a.Data(), a.GetRowStride(), b.Data(),
+                  b.GetRowStride(), c.Data(), c.GetRowStride(), cutoff,
+                  workspace.Get());
+  return result;
+}
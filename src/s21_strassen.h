@@ -0,0 +1,27 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_STRASSEN_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_STRASSEN_H_
+
+#include <cstddef>
+
+#include "s21_matrix_oop.h"
+
+// Products with any dimension at or below the cutoff use S21Gemm directly.
+constexpr int kS21StrassenDefaultCutoff = 256;
+
+// C = A * B by the Strassen-Winograd recursion: 7 half-size products and 15
+// additions per level instead of 8 products. Odd dimensions are handled by
+// peeling the last row, column or inner index into rank-1 and panel updates.
+// All levels share one workspace of S21StrassenWorkspaceSize() doubles.
+//
+// The error is bounded normwise rather than elementwise: it may exceed that
+// of S21Gemm by a factor growing like (n / cutoff)^2.17.
+void S21StrassenGemm(int m, int n, int k, const double* a, std::ptrdiff_t lda,
+                     const double* b, std::ptrdiff_t ldb, double* c,
+                     std::ptrdiff_t ldc, int cutoff, double* workspace);
+std::size_t S21StrassenWorkspaceSize(int m, int n, int k, int cutoff);
+
+// Takes its workspace from the current S21MatrixArena when there is one.
+S21Matrix S21StrassenMultiply(const S21Matrix& left, const S21Matrix& right,
+                              int cutoff = kS21StrassenDefaultCutoff);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_STRASSEN_H_
@@ -0,0 +1,135 @@
+#include "s21_thread_pool.h"
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+thread_local bool in_parallel_region = false;
+
+}  // namespace
+
+S21ThreadPool::S21ThreadPool(int thread_count)
+    : thread_count_(1),
+      task_(nullptr),
+      task_count_(0),
+      next_task_(0),
+      pending_workers_(0),
+      generation_(0),
+      stopping_(false) {
+  if (thread_count <= 0)
+    throw std::logic_error("The number of threads must be positive");
+  StartWorkers(thread_count - 1);
+}
+
+S21ThreadPool::~S21ThreadPool() { StopWorkers(); }
+
+S21ThreadPool& S21ThreadPool::Global() {
+  static S21ThreadPool pool;
+  return pool;
+}
+
+int S21ThreadPool::DefaultThreadCount() {
+  const char* env = std::getenv("S21_NUM_THREADS");
+  if (env) {
+    int count = std::atoi(env);
+    if (count > 0) return count;
+  }
+  int count = static_cast<int>(std::thread::hardware_concurrency());
+  return count > 0 ? count : 1;
+}
+
+int S21ThreadPool::GetThreadCount() const noexcept {
+  return thread_count_.load(std::memory_order_relaxed);
+}
+
+void S21ThreadPool::SetThreadCount(int thread_count) {
+  if (thread_count <= 0)
+    throw std::logic_error("The number of threads must be positive");
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  if (thread_count == GetThreadCount()) return;
+  StopWorkers();
+  StartWorkers(thread_count - 1);
+}
+
+void S21ThreadPool::StartWorkers(int worker_count) {
+  stopping_ = false;
+  workers_.reserve(worker_count);
+  for (int i = 0; i < worker_count; i++) {
+    workers_.emplace_back(&S21ThreadPool::WorkerLoop, this, generation_);
+  }
+  thread_count_ = worker_count + 1;
+}
+
+void S21ThreadPool::StopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  start_condition_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+  workers_.clear();
+  thread_count_ = 1;
+}
+
+void S21ThreadPool::ParallelFor(int count,
+                                const std::function<void(int)>& task) {
+  if (count <= 0) return;
+
+  std::unique_lock<std::mutex> run_lock(run_mutex_, std::defer_lock);
+  if (count == 1 || in_parallel_region || !run_lock.try_lock() ||
+      workers_.empty()) {
+    for (int i = 0; i < count; i++) task(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    task_count_ = count;
+    next_task_ = 0;
+    pending_workers_ = static_cast<int>(workers_.size());
+    exception_ = nullptr;
+    generation_++;
+  }
+  start_condition_.notify_all();
+
+  in_parallel_region = true;
+  RunTasks();
+  in_parallel_region = false;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_condition_.wait(lock, [this] { return pending_workers_ == 0; });
+  task_ = nullptr;
+  if (exception_) std::rethrow_exception(exception_);
+}
+
+void S21ThreadPool::WorkerLoop(std::uint64_t seen_generation) {
+  in_parallel_region = true;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    start_condition_.wait(lock, [this, seen_generation] {
+      return stopping_ || generation_ != seen_generation;
+    });
+    if (stopping_) return;
+    seen_generation = generation_;
+
+    lock.unlock();
+    RunTasks();
+    lock.lock();
+
+    if (--pending_workers_ == 0) done_condition_.notify_one();
+  }
+}
+
+void S21ThreadPool::RunTasks() {
+  for (int i = next_task_++; i < task_count_; i = next_task_++) {
+    try {
+      (*task_)(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) exception_ = std::current_exception();
+    }
+  }
+}
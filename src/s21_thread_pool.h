@@ -0,0 +1,49 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_S21_THREAD_POOL_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class S21ThreadPool {
+ public:
+  explicit S21ThreadPool(int thread_count = DefaultThreadCount());
+  S21ThreadPool(const S21ThreadPool& other) = delete;
+  S21ThreadPool& operator=(const S21ThreadPool& other) = delete;
+  ~S21ThreadPool();
+
+  static S21ThreadPool& Global();
+  static int DefaultThreadCount();
+
+  int GetThreadCount() const noexcept;
+  void SetThreadCount(int thread_count);
+  void ParallelFor(int count, const std::function<void(int)>& task);
+
+ private:
+  void StartWorkers(int worker_count);
+  void StopWorkers();
+  void WorkerLoop(std::uint64_t seen_generation);
+  void RunTasks();
+
+  std::vector<std::thread> workers_;
+  // workers_.size() + 1, readable without taking run_mutex_.
+  std::atomic<int> thread_count_;
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  std::condition_variable start_condition_;
+  std::condition_variable done_condition_;
+  const std::function<void(int)>* task_;
+  int task_count_;
+  std::atomic<int> next_task_;
+  int pending_workers_;
+  std::uint64_t generation_;
+  bool stopping_;
+  std::exception_ptr exception_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_S21_THREAD_POOL_H_
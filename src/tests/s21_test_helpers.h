@@ -0,0 +1,20 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_SRC_TESTS_S21_TEST_HELPERS_H_
+#define CPP1_S21_MATRIXPLUS_1_SRC_TESTS_S21_TEST_HELPERS_H_
+
+#include "../s21_matrix_oop.h"
+
+// Deterministic, well-mixed entries in [-2.75, 2.75]; seeds give different
+// matrices of the same size.
+inline double TestValue(int row, int col, int seed) {
+  return ((row * 131 + col * 71 + seed * 29) % 23 - 11) / 4.0;
+}
+
+inline S21Matrix MakeMatrix(int rows, int cols, int seed) {
+  S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) matrix(i, j) = TestValue(i, j, seed);
+  }
+  return matrix;
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_SRC_TESTS_S21_TEST_HELPERS_H_
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+#include "../s21_basic_matrix.h"
+#include "../s21_decomposition.h"
+#include "../s21_matrix_oop.h"
+#include "s21_test_helpers.h"
+
+static S21Matrix MakeDominant(int size, int seed) {
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix(i, j) = std::sin(i * 0.37 + j * 1.91 + seed);
+    }
+    matrix(i, i) += size;
+  }
+  return matrix;
+}
+
+TEST(BasicMatrix, Subtest_1) {
+  S21FloatMatrix first = S21FloatMatrix(MakeMatrix(70, 90, 1));
+  S21FloatMatrix second = S21FloatMatrix(MakeMatrix(90, 50, 2));
+  S21FloatMatrix product = first * second;
+  for (int i = 0; i < 70; i++) {
+    for (int j = 0; j < 50; j++) {
+      double expected = 0;
+      for (int k = 0; k < 90; k++) expected += first(i, k) * second(k, j);
+      EXPECT_NEAR(product(i, j), expected, 1e-3);
+    }
+  }
+
+  S21Matrix converted = static_cast<S21Matrix>(first);
+  EXPECT_EQ(converted(3, 4), first(3, 4));
+  EXPECT_EQ(S21FloatMatrix(converted).EqMatrix(first), true);
+  EXPECT_EQ(S21BasicMatrix<double>(first)(5, 6), first(5, 6));
+}
+
+TEST(BasicMatrix, Subtest_2) {
+  S21FloatMatrix matrix(3, 3);
+  matrix(0, 0) = 2;
+  matrix(0, 1) = 5;
+  matrix(0, 2) = 7;
+  matrix(1, 0) = 6;
+  matrix(1, 1) = 3;
+  matrix(1, 2) = 4;
+  matrix(2, 0) = 5;
+  matrix(2, 1) = -2;
+  matrix(2, 2) = -3;
+  EXPECT_NEAR(matrix.Determinant(), -1, 1e-5);
+  S21FloatMatrix identity(3, 3);
+  for (int i = 0; i < 3; i++) identity(i, i) = 1;
+  EXPECT_EQ((matrix * matrix.InverseMatrix()).EqMatrix(identity), true);
+  S21FloatMatrix complements = matrix.CalcComplements();
+  EXPECT_NEAR(complements(0, 0), -1, 1e-5);
+  EXPECT_NEAR(complements(1, 2), 29, 1e-5);
+  EXPECT_NEAR(complements(2, 1), 34, 1e-5);
+
+  S21FloatMatrix sum = matrix + matrix * 2.0f;
+  EXPECT_EQ(sum.EqMatrix(3.0f * matrix), true);
+  sum -= matrix;
+  EXPECT_EQ(sum.EqMatrix(matrix * 2.0f), true);
+}
+
+TEST(BasicMatrix, Subtest_3) {
+  using Complex = std::complex<double>;
+  S21ComplexMatrix matrix(2, 2);
+  matrix(0, 0) = Complex(1, 1);
+  matrix(0, 1) = Complex(2, 0);
+  matrix(1, 0) = Complex(0, -1);
+  matrix(1, 1) = Complex(3, 2);
+  Complex determinant = matrix.Determinant();
+  EXPECT_NEAR(determinant.real(), 1, 1e-12);
+  EXPECT_NEAR(determinant.imag(), 7, 1e-12);
+
+  S21ComplexMatrix identity(2, 2);
+  identity(0, 0) = identity(1, 1) = 1;
+  EXPECT_EQ((matrix * matrix.InverseMatrix()).EqMatrix(identity), true);
+  S21ComplexMatrix complements = matrix.CalcComplements();
+  EXPECT_EQ(complements(0, 0), Complex(3, 2));
+  EXPECT_EQ(complements(0, 1), Complex(0, 1));
+
+  S21ComplexMatrix large(S21BasicMatrix<double>(MakeDominant(40, 1)));
+  large.MulNumber(Complex(0, 1));
+  S21ComplexMatrix rhs(40, 2);
+  rhs(7, 0) = Complex(1, -1);
+  rhs(9, 1) = 2;
+  EXPECT_EQ((large * large.Solve(rhs)).EqMatrix(rhs), true);
+}
+
+TEST(BasicMatrix, Subtest_4) {
+  S21FloatMatrix matrix(2, 3);
+  EXPECT_THROW(S21FloatMatrix(0, 3), std::logic_error);
+  EXPECT_THROW(matrix(2, 0), std::out_of_range);
+  EXPECT_THROW(matrix.Determinant(), std::logic_error);
+  EXPECT_THROW(matrix * matrix, std::logic_error);
+  EXPECT_THROW(matrix.SumMatrix(S21FloatMatrix(3, 2)), std::logic_error);
+  EXPECT_THROW(S21FloatMatrix(2, 2).InverseMatrix(), std::logic_error);
+
+  matrix(1, 2) = 5;
+  matrix.SetCols(4);
+  matrix.SetRows(3);
+  EXPECT_EQ(matrix(1, 2), 5);
+  EXPECT_EQ(matrix(2, 3), 0);
+  matrix.SetCols(2);
+  EXPECT_THROW(matrix(1, 2), std::out_of_range);
+}
+
+TEST(BasicMatrix, Subtest_5) {
+  S21FloatMatrix matrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) matrix(i, j) = 3 * i + j + 1;
+  }
+  S21FloatMatrix complements = matrix.CalcComplements();
+  EXPECT_NEAR(complements(0, 0), -3, 1e-4);
+  EXPECT_NEAR(complements(0, 1), 6, 1e-4);
+  EXPECT_NEAR(complements(0, 2), -3, 1e-4);
+  EXPECT_NEAR(complements(1, 1), -12, 1e-4);
+  EXPECT_NEAR(complements(2, 2), -3, 1e-4);
+
+  using Complex = std::complex<double>;
+  S21ComplexMatrix singular(2, 2);
+  singular(0, 0) = 1;
+  singular(0, 1) = singular(1, 0) = Complex(0, 1);
+  singular(1, 1) = -1;
+  S21ComplexMatrix expected(2, 2);
+  expected(0, 0) = -1;
+  expected(0, 1) = expected(1, 0) = Complex(0, -1);
+  expected(1, 1) = 1;
+  EXPECT_EQ(singular.CalcComplements().EqMatrix(expected), true);
+  EXPECT_EQ(S21ComplexMatrix(3, 3).CalcComplements().EqMatrix(
+                S21ComplexMatrix(3, 3)),
+            true);
+}
+
+TEST(MixedPrecisionSolver, Subtest_1) {
+  S21Matrix matrix = MakeDominant(300, 2);
+  S21Matrix rhs(300, 3);
+  for (int i = 0; i < 300; i++) {
+    for (int j = 0; j < 3; j++) rhs(i, j) = std::cos(i * 0.1 + j);
+  }
+  S21MixedPrecisionSolver solver(matrix);
+  S21Matrix solution = solver.Solve(rhs);
+  EXPECT_EQ(solver.UsesDoublePrecision(), false);
+  EXPECT_GT(solver.GetIterations(), 0);
+  EXPECT_LE(solver.GetIterations(), 5);
+
+  S21Matrix expected = matrix.Solve(rhs);
+  for (int i = 0; i < 300; i++) {
+    for (int j = 0; j < 3; j++) {
+      EXPECT_NEAR(solution(i, j), expected(i, j), 1e-14);
+    }
+  }
+}
+
+TEST(MixedPrecisionSolver, Subtest_2) {
+  int size = 10;
+  S21Matrix hilbert(size, size), rhs(size, 1);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) hilbert(i, j) = 1.0 / (i + j + 1);
+    rhs(i, 0) = 1;
+  }
+  S21MixedPrecisionSolver solver(hilbert);
+  S21Matrix solution = solver.Solve(rhs);
+  EXPECT_EQ(solver.UsesDoublePrecision(), true);
+  EXPECT_EQ(solution.EqMatrix(hilbert.Solve(rhs)), true);
+
+  EXPECT_THROW(S21MixedPrecisionSolver(S21Matrix(2, 3)), std::logic_error);
+  EXPECT_THROW(solver.Solve(S21Matrix(3, 1)), std::logic_error);
+}
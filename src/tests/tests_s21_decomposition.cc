@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../s21_decomposition.h"
+#include "../s21_matrix_oop.h"
+
+static S21Matrix MakeGeneralMatrix(int size) {
+  S21Matrix matrix(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      matrix(i, j) = ((i * 19 + j * 7) % 17 - 8) / 4.0;
+    }
+    matrix(i, i) += size / 2.0;
+  }
+  return matrix;
+}
+
+static S21Matrix MakeSpdMatrix(int size) {
+  S21Matrix factor(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) factor(i, j) = ((i * 5 + j * 3) % 11) / 5.0;
+  }
+  S21Matrix result = factor * factor.Transpose();
+  for (int i = 0; i < size; i++) result(i, i) += size;
+  return result;
+}
+
+static S21Matrix MakeRhs(int rows, int cols, int seed) {
+  S21Matrix rhs(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) rhs(i, j) = (i * 3 + j * 7 + seed) % 13 - 6;
+  }
+  return rhs;
+}
+
+TEST(LuDecomposition, Subtest_1) {
+  for (int size : {1, 5, 64, 130}) {
+    S21Matrix matrix = MakeGeneralMatrix(size);
+    S21Matrix rhs = MakeRhs(size, 3, size);
+    S21LuDecomposition lu(matrix);
+    EXPECT_EQ(lu.GetSize(), size);
+    EXPECT_EQ(lu.IsSingular(), false);
+    S21Matrix solution = lu.Solve(rhs);
+    EXPECT_EQ(rhs.EqMatrix(matrix * solution), true);
+    EXPECT_EQ(solution.EqMatrix(matrix.Solve(rhs)), true);
+    EXPECT_NEAR(lu.Determinant(), matrix.Determinant(),
+                1e-12 * fabs(matrix.Determinant()));
+  }
+}
+
+TEST(LuDecomposition, Subtest_2) {
+  S21Matrix matrix = MakeGeneralMatrix(90);
+  std::vector<S21Matrix> rhs;
+  for (int i = 0; i < 20; i++) rhs.push_back(MakeRhs(90, 1 + i % 4, i));
+
+  std::vector<S21Matrix> solutions = matrix.SolveMany(rhs);
+  ASSERT_EQ(solutions.size(), rhs.size());
+  for (std::size_t i = 0; i < rhs.size(); i++) {
+    EXPECT_EQ(solutions[i].GetCols(), rhs[i].GetCols());
+    EXPECT_EQ(rhs[i].EqMatrix(matrix * solutions[i]), true);
+  }
+  EXPECT_EQ(S21LuDecomposition(matrix).SolveMany({}).empty(), true);
+}
+
+TEST(LuDecomposition, Subtest_3) {
+  S21Matrix singular(3, 3), non_square(2, 3);
+  singular(0, 0) = 1;
+  singular(0, 1) = 2;
+  singular(1, 0) = 2;
+  singular(1, 1) = 4;
+  singular(2, 2) = 1;
+
+  S21LuDecomposition lu(singular);
+  EXPECT_EQ(lu.IsSingular(), true);
+  EXPECT_ANY_THROW(lu.Solve(MakeRhs(3, 1, 0)));
+  EXPECT_ANY_THROW(singular.Solve(MakeRhs(3, 1, 0)));
+  EXPECT_ANY_THROW(S21LuDecomposition invalid(non_square));
+  EXPECT_ANY_THROW(non_square.Solve(MakeRhs(2, 1, 0)));
+
+  S21LuDecomposition regular(MakeGeneralMatrix(4));
+  EXPECT_ANY_THROW(regular.Solve(MakeRhs(5, 1, 0)));
+  EXPECT_ANY_THROW(regular.SolveMany({MakeRhs(4, 1, 0), MakeRhs(3, 1, 0)}));
+}
+
+TEST(CholeskyDecomposition, Subtest_1) {
+  for (int size : {1, 7, 64, 150}) {
+    S21Matrix matrix = MakeSpdMatrix(size);
+    S21CholeskyDecomposition cholesky(matrix);
+    EXPECT_EQ(cholesky.GetSize(), size);
+
+    S21Matrix l = cholesky.GetL();
+    EXPECT_EQ(matrix.EqMatrix(l * l.Transpose()), true);
+    for (int i = 0; i < size; i++) {
+      for (int j = i + 1; j < size; j++) EXPECT_EQ(l(i, j), 0);
+    }
+
+    S21Matrix rhs = MakeRhs(size, 5, size);
+    EXPECT_EQ(rhs.EqMatrix(matrix * cholesky.Solve(rhs)), true);
+    if (size <= 7) {
+      EXPECT_NEAR(cholesky.Determinant(), matrix.Determinant(),
+                  1e-9 * cholesky.Determinant());
+    }
+  }
+}
+
+TEST(CholeskyDecomposition, Subtest_2) {
+  S21Matrix matrix = MakeSpdMatrix(40);
+  S21CholeskyDecomposition cholesky(matrix);
+  std::vector<S21Matrix> rhs = {MakeRhs(40, 1, 1), MakeRhs(40, 7, 2)};
+  std::vector<S21Matrix> solutions = cholesky.SolveMany(rhs);
+  ASSERT_EQ(solutions.size(), 2u);
+  EXPECT_EQ(rhs[0].EqMatrix(matrix * solutions[0]), true);
+  EXPECT_EQ(rhs[1].EqMatrix(matrix * solutions[1]), true);
+}
+
+TEST(CholeskyDecomposition, Subtest_3) {
+  S21Matrix indefinite(2, 2), non_square(3, 2);
+  indefinite(0, 0) = 1;
+  indefinite(0, 1) = 2;
+  indefinite(1, 0) = 2;
+  indefinite(1, 1) = 1;
+  EXPECT_ANY_THROW(S21CholeskyDecomposition invalid(indefinite));
+  EXPECT_ANY_THROW(S21CholeskyDecomposition invalid(non_square));
+  EXPECT_ANY_THROW(S21CholeskyDecomposition invalid(S21Matrix(3, 3)));
+
+  S21CholeskyDecomposition cholesky(MakeSpdMatrix(3));
+  EXPECT_ANY_THROW(cholesky.Solve(MakeRhs(2, 1, 0)));
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_execution.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_thread_pool.h"
+#include "s21_test_helpers.h"
+
+static void ExpectReductions(const S21Matrix& matrix, const S21Matrix& other,
+                             const S21ExecutionPolicy& policy) {
+  double sum = 0, dot = 0, squares = 0, norm_inf = 0;
+  std::vector<double> column_sums(matrix.GetCols(), 0.0);
+  for (int i = 0; i < matrix.GetRows(); i++) {
+    double row_sum = 0;
+    for (int j = 0; j < matrix.GetCols(); j++) {
+      sum += matrix(i, j);
+      dot += matrix(i, j) * other(i, j);
+      squares += matrix(i, j) * matrix(i, j);
+      row_sum += fabs(matrix(i, j));
+      column_sums[j] += fabs(matrix(i, j));
+    }
+    norm_inf = std::max(norm_inf, row_sum);
+  }
+  double norm_one = *std::max_element(column_sums.begin(), column_sums.end());
+  EXPECT_NEAR(matrix.Sum(policy), sum, 1e-9 * matrix.GetRows());
+  EXPECT_NEAR(matrix.Dot(policy, other), dot, 1e-9 * matrix.GetRows());
+  EXPECT_NEAR(matrix.FrobeniusNorm(policy), sqrt(squares), 1e-9);
+  EXPECT_DOUBLE_EQ(matrix.NormOne(policy), norm_one);
+  EXPECT_DOUBLE_EQ(matrix.NormInf(policy), norm_inf);
+}
+
+TEST(Execution, Subtest_1) {
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int thread_count = pool.GetThreadCount();
+  pool.SetThreadCount(4);
+  EXPECT_EQ(S21RowChunkCount(kS21Seq, 1000, 1000), 1);
+  EXPECT_EQ(S21RowChunkCount(kS21Par, 1000, 1000), 4);
+  EXPECT_EQ(S21RowChunkCount(kS21ParUnseq, 10, 10), 1);
+  EXPECT_EQ(S21RowChunkCount(kS21Par, 2, 1 << 20), 2);
+
+  S21Matrix first = MakeMatrix(611, 503, 1);
+  S21Matrix second = MakeMatrix(611, 503, 2);
+  S21Matrix copy(kS21Par, first);
+  EXPECT_EQ(copy.EqMatrix(kS21Par, first), true);
+  copy(610, 502) += 1;
+  EXPECT_EQ(copy.EqMatrix(kS21ParUnseq, first), false);
+
+  S21Matrix expected = first;
+  expected.SumMatrix(second);
+  expected.MulNumber(3.5);
+  expected.SubMatrix(first);
+  S21Matrix result(kS21ParUnseq, first);
+  result.SumMatrix(kS21Par, second);
+  result.MulNumber(kS21ParUnseq, 3.5);
+  result.SubMatrix(kS21Par, first);
+  EXPECT_EQ(result.EqMatrix(expected), true);
+  ExpectReductions(result, second, kS21Par);
+
+  EXPECT_THROW(result.SumMatrix(kS21Par, S21Matrix(611, 502)),
+               std::logic_error);
+  EXPECT_EQ(result.EqMatrix(kS21Par, S21Matrix(611, 502)), false);
+  pool.SetThreadCount(thread_count);
+}
+
+TEST(Execution, Subtest_2) {
+  S21Matrix matrix = MakeMatrix(7, 5, 3);
+  S21Matrix other = MakeMatrix(7, 5, 4);
+  ExpectReductions(matrix, other, kS21Seq);
+  ExpectReductions(matrix, other, kS21Par);
+
+  S21Matrix square(3, 3);
+  square(0, 0) = 1.5;
+  square(1, 1) = -4;
+  square(2, 2) = 7;
+  square(0, 2) = 100;
+  EXPECT_EQ(square.Trace(), 4.5);
+  EXPECT_THROW(matrix.Trace(), std::logic_error);
+  EXPECT_THROW(matrix.Dot(square), std::logic_error);
+}
+
+TEST(Execution, Subtest_3) {
+  S21Matrix matrix = MakeMatrix(4, 4, 1);
+  S21Matrix moved = std::move(matrix);
+  EXPECT_EQ(matrix.Sum(), 0);
+  EXPECT_EQ(matrix.FrobeniusNorm(kS21Par), 0);
+  EXPECT_EQ(matrix.NormOne(), 0);
+  EXPECT_EQ(matrix.NormOne(kS21Par), 0);
+  EXPECT_EQ(matrix.NormInf(), 0);
+  EXPECT_EQ(matrix.NormInf(kS21Par), 0);
+}
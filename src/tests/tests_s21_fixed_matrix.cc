@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "../s21_fixed_matrix.h"
+#include "s21_test_helpers.h"
+
+template <int R, int C>
+static S21FixedMatrix<R, C> MakeFixed(int seed) {
+  S21FixedMatrix<R, C> matrix;
+  for (int i = 0; i < R; i++) {
+    for (int j = 0; j < C; j++) {
+      matrix(i, j) = TestValue(i, j, seed) + (i == j ? 3 : 0);
+    }
+  }
+  return matrix;
+}
+
+template <int N>
+static void ExpectMatchesDynamic(int seed) {
+  S21FixedMatrix<N, N> fixed = MakeFixed<N, N>(seed);
+  S21Matrix dynamic(fixed);
+  EXPECT_NEAR(fixed.Determinant(), dynamic.Determinant(),
+              1e-9 * (1 + fabs(dynamic.Determinant())));
+  EXPECT_EQ(static_cast<S21Matrix>(fixed.InverseMatrix())
+                .EqMatrix(dynamic.InverseMatrix()),
+            true);
+  EXPECT_EQ(static_cast<S21Matrix>(fixed.CalcComplements())
+                .EqMatrix(dynamic.CalcComplements()),
+            true);
+}
+
+TEST(FixedMatrix, Subtest_1) {
+  static_assert(sizeof(S21FixedMatrix<3, 3>) == 9 * sizeof(double));
+  static_assert(S21FixedMatrix<2, 5>::GetRows() == 2);
+  static_assert(S21FixedMatrix<2, 5>::GetCols() == 5);
+  static_assert(std::is_same_v<decltype(S21FixedMatrix<2, 3>() *
+                                        S21FixedMatrix<3, 4>()),
+                               S21FixedMatrix<2, 4>>);
+  static_assert(std::is_same_v<decltype(S21FixedMatrix<2, 3>().Transpose()),
+                               S21FixedMatrix<3, 2>>);
+
+  S21FixedMatrix<2, 3> first = MakeFixed<2, 3>(1);
+  S21FixedMatrix<3, 4> second = MakeFixed<3, 4>(2);
+  S21Matrix expected = S21Matrix(first) * S21Matrix(second);
+  EXPECT_EQ(S21Matrix(first * second).EqMatrix(expected), true);
+  EXPECT_EQ(S21Matrix(first.Transpose()).EqMatrix(S21Matrix(first).Transpose()),
+            true);
+
+  S21FixedMatrix<2, 3> sum = first + first * 2.0 - 0.5 * first;
+  sum -= first;
+  sum *= 2;
+  EXPECT_EQ(sum == first * 3.0, true);
+  EXPECT_EQ(sum == first, false);
+
+  EXPECT_THROW(first(2, 0), std::out_of_range);
+  EXPECT_THROW((S21FixedMatrix<2, 2>(S21Matrix(2, 3))), std::logic_error);
+}
+
+TEST(FixedMatrix, Subtest_2) {
+  for (int seed = 0; seed < 5; seed++) {
+    ExpectMatchesDynamic<1>(seed);
+    ExpectMatchesDynamic<2>(seed);
+    ExpectMatchesDynamic<3>(seed);
+    ExpectMatchesDynamic<4>(seed);
+    ExpectMatchesDynamic<6>(seed);
+  }
+}
+
+TEST(FixedMatrix, Subtest_3) {
+  S21FixedMatrix<3, 3> singular;
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) singular(i, j) = i * 3 + j + 1;
+  }
+  EXPECT_NEAR(singular.Determinant(), 0, 1e-12);
+  EXPECT_THROW(singular.InverseMatrix(), std::logic_error);
+  EXPECT_EQ(static_cast<S21Matrix>(singular.CalcComplements())
+                .EqMatrix(S21Matrix(singular).CalcComplements()),
+            true);
+
+  S21FixedMatrix<4, 4> zero;
+  EXPECT_EQ(zero.Determinant(), 0);
+  EXPECT_THROW(zero.InverseMatrix(), std::logic_error);
+}
+
+TEST(FixedMatrix, Subtest_4) {
+  S21FixedMatrix<4, 4> transform = MakeFixed<4, 4>(3);
+  S21Matrix points(4, 10);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 10; j++) points(i, j) = i - j;
+  }
+  S21Matrix moved = transform.View() * points;
+  EXPECT_EQ(moved.EqMatrix(S21Matrix(transform) * points), true);
+
+  S21Matrix block(6, 6);
+  block.Block(1, 1, 4, 4).Assign(transform.View());
+  EXPECT_EQ(block(4, 4), transform(3, 3));
+
+  transform.View().MulNumber(2);
+  S21FixedMatrix<4, 4> twice = MakeFixed<4, 4>(3) * 2.0;
+  EXPECT_EQ(transform == twice, true);
+  transform.MulMatrix(transform.InverseMatrix());
+  S21FixedMatrix<4, 4> identity;
+  for (int i = 0; i < 4; i++) identity(i, i) = 1;
+  EXPECT_EQ(transform == identity, true);
+}
+
+TEST(FixedMatrix, Subtest_5) {
+  S21FixedMatrix<3, 3> scaled;
+  scaled(0, 0) = 1e-8;
+  scaled(1, 1) = 1e-8;
+  scaled(2, 2) = 1;
+  S21Matrix dynamic(scaled);
+  EXPECT_EQ(static_cast<S21Matrix>(scaled.InverseMatrix())
+                .EqMatrix(dynamic.InverseMatrix()),
+            true);
+
+  S21FixedMatrix<4, 4> rows = MakeFixed<4, 4>(2);
+  for (int j = 0; j < 4; j++) {
+    rows(0, j) *= 1e-8;
+    rows(2, j) *= 1e-7;
+  }
+  S21Matrix inverse = S21Matrix(rows).InverseMatrix();
+  S21Matrix fixed_inverse(rows.InverseMatrix());
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_NEAR(fixed_inverse(i, j), inverse(i, j),
+                  1e-9 * fabs(inverse(i, j)));
+    }
+  }
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../s21_gemm.h"
+#include "../s21_matrix_oop.h"
+#include "s21_test_helpers.h"
+
+static S21Matrix NaiveMul(const S21Matrix& first, const S21Matrix& second) {
+  S21Matrix result(first.GetRows(), second.GetCols());
+  for (int i = 0; i < first.GetRows(); i++) {
+    for (int j = 0; j < second.GetCols(); j++) {
+      double sum = 0;
+      for (int k = 0; k < first.GetCols(); k++) {
+        sum += first(i, k) * second(k, j);
+      }
+      result(i, j) = sum;
+    }
+  }
+  return result;
+}
+
+TEST(Gemm, Subtest_1) {
+  S21Matrix first = MakeMatrix(37, 129, 1);
+  S21Matrix second = MakeMatrix(129, 61, 2);
+  EXPECT_EQ(NaiveMul(first, second).EqMatrix(first * second), true);
+}
+
+TEST(Gemm, Subtest_2) {
+  S21Matrix first = MakeMatrix(203, 301, 3);
+  S21Matrix second = MakeMatrix(301, 157, 4);
+  S21Matrix expected = NaiveMul(first, second);
+  first.MulMatrix(second);
+  EXPECT_EQ(expected.EqMatrix(first), true);
+}
+
+TEST(Gemm, Subtest_3) {
+  S21Matrix first = MakeMatrix(1, 1000, 5);
+  S21Matrix second = MakeMatrix(1000, 1, 6);
+  EXPECT_EQ(NaiveMul(first, second).EqMatrix(first * second), true);
+  EXPECT_EQ(NaiveMul(second, first).EqMatrix(second * first), true);
+}
+
+TEST(Gemm, Subtest_4) {
+  const int m = 70, n = 90, k = 110;
+  std::vector<double> a(m * k), b_transposed(n * k), c(m * n, 1.0);
+  for (int i = 0; i < m * k; i++) a[i] = (i % 13) - 6;
+  for (int i = 0; i < n * k; i++) b_transposed[i] = (i % 7) - 3;
+
+  S21Gemm(m, n, k, a.data(), k, 1, b_transposed.data(), 1, k, c.data(), n);
+
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double expected = 1.0;
+      for (int p = 0; p < k; p++) {
+        expected += a[i * k + p] * b_transposed[j * k + p];
+      }
+      EXPECT_DOUBLE_EQ(c[i * n + j], expected);
+    }
+  }
+}
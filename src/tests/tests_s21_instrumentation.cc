@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "../s21_instrumentation.h"
+#include "../s21_matrix_oop.h"
+
+TEST(Instrumentation, Subtest_1) {
+  S21ResetInstrumentation();
+  S21Matrix first(4, 6), second(6, 5);
+  for (int i = 0; i < 4; i++) first(i, i) = 2;
+  S21Matrix product = first * second;
+  product.MulNumber(3);
+  product.SumMatrix(product);
+  S21Matrix copy = product;
+  EXPECT_EQ(copy.EqMatrix(product), true);
+
+  S21InstrumentationSnapshot snapshot = S21TakeInstrumentationSnapshot();
+  const S21OperationStats& multiply = snapshot[S21Operation::kMulMatrix];
+  if (!S21InstrumentationEnabled()) {
+    EXPECT_EQ(multiply.calls, 0u);
+    EXPECT_EQ(snapshot[S21Operation::kOther].bytes_allocated, 0u);
+    return;
+  }
+  EXPECT_EQ(multiply.calls, 1u);
+  EXPECT_EQ(multiply.flops, 2u * 4 * 6 * 5);
+  EXPECT_EQ(multiply.bytes_allocated, 4u * 5 * sizeof(double));
+  EXPECT_EQ(snapshot[S21Operation::kMulNumber].calls, 1u);
+  EXPECT_EQ(snapshot[S21Operation::kMulNumber].flops, 20u);
+  EXPECT_EQ(snapshot[S21Operation::kSumMatrix].calls, 1u);
+  EXPECT_EQ(snapshot[S21Operation::kEqMatrix].calls, 1u);
+  EXPECT_EQ(snapshot[S21Operation::kCopy].calls, 1u);
+  EXPECT_EQ(snapshot[S21Operation::kCopy].bytes_allocated,
+            4u * 5 * sizeof(double));
+  EXPECT_EQ(snapshot[S21Operation::kOther].bytes_allocated,
+            (4u * 6 + 6 * 5) * sizeof(double));
+  EXPECT_EQ(snapshot[S21Operation::kInverseMatrix].calls, 0u);
+}
+
+TEST(Instrumentation, Subtest_2) {
+  S21ResetInstrumentation();
+  auto work = [] {
+    S21Matrix matrix(3, 3);
+    for (int i = 0; i < 3; i++) matrix(i, i) = i + 1;
+    for (int k = 0; k < 10; k++) {
+      S21Matrix inverse = matrix.InverseMatrix();
+      EXPECT_NEAR(matrix.Determinant(), 6, 1e-12);
+    }
+  };
+  std::thread finished(work);
+  finished.join();
+  work();
+
+  S21InstrumentationSnapshot snapshot = S21TakeInstrumentationSnapshot();
+  std::uint64_t expected = S21InstrumentationEnabled() ? 20 : 0;
+  EXPECT_EQ(snapshot[S21Operation::kInverseMatrix].calls, expected);
+  EXPECT_EQ(snapshot[S21Operation::kDeterminant].calls, expected);
+  EXPECT_EQ(snapshot[S21Operation::kDeterminant].flops, expected * 18);
+
+  S21ResetInstrumentation();
+  snapshot = S21TakeInstrumentationSnapshot();
+  EXPECT_EQ(snapshot[S21Operation::kInverseMatrix].calls, 0u);
+  EXPECT_EQ(snapshot[S21Operation::kInverseMatrix].nanoseconds, 0u);
+}
+
+TEST(Instrumentation, Subtest_3) {
+  S21ResetInstrumentation();
+  S21Matrix matrix(2, 2);
+  matrix.SetCols(3);
+  S21InstrumentationSnapshot snapshot = S21TakeInstrumentationSnapshot();
+  std::string calls = S21InstrumentationEnabled() ? "1" : "0";
+
+  std::string json = snapshot.ToJson();
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"Resize\": {\"calls\": " + calls + ", \"flops\": 0"),
+            std::string::npos);
+
+  std::string text = snapshot.ToPrometheus();
+  EXPECT_NE(text.find("# TYPE s21_matrix_operation_calls_total counter\n"),
+            std::string::npos);
+  std::string resize_calls =
+      "s21_matrix_operation_calls_total{operation=\"Resize\"} " + calls;
+  EXPECT_NE(text.find(resize_calls + "\n"), std::string::npos);
+  EXPECT_NE(text.find("s21_matrix_operation_seconds_total{operation=\"Solve\"} "
+                      "0\n"),
+            std::string::npos);
+  EXPECT_EQ(std::string(S21OperationName(S21Operation::kCalcComplements)),
+            "CalcComplements");
+}
+
+TEST(Instrumentation, Subtest_4) {
+  S21Matrix first(3, 4), second(3, 4);
+  S21ResetInstrumentation();
+  S21Matrix sum = first + second;
+  S21Matrix difference = first - (second * 2.0);
+  S21Matrix fused = first.Lazy() + second - first.Lazy() * 0.5;
+  fused += first.Lazy() * 2.0;
+  S21InstrumentationSnapshot snapshot = S21TakeInstrumentationSnapshot();
+  std::uint64_t enabled = S21InstrumentationEnabled() ? 1 : 0;
+
+  EXPECT_EQ(snapshot[S21Operation::kSumMatrix].calls, enabled);
+  EXPECT_EQ(snapshot[S21Operation::kSumMatrix].flops, enabled * 12);
+  EXPECT_EQ(snapshot[S21Operation::kSumMatrix].bytes_allocated,
+            enabled * 12 * sizeof(double));
+  EXPECT_EQ(snapshot[S21Operation::kSubMatrix].calls, enabled);
+  EXPECT_EQ(snapshot[S21Operation::kMulNumber].calls, enabled);
+  EXPECT_EQ(snapshot[S21Operation::kCopy].calls, 0u);
+  EXPECT_EQ(snapshot[S21Operation::kExpression].calls, enabled * 2);
+  EXPECT_EQ(snapshot[S21Operation::kExpression].flops, enabled * 12 * 5);
+  EXPECT_EQ(std::string(S21OperationName(S21Operation::kExpression)),
+            "Expression");
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "../s21_matrix_arena.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_simd.h"
+
+static bool IsInside(const S21Matrix& matrix, const S21Matrix& first,
+                     std::size_t bytes) {
+  const char* data = reinterpret_cast<const char*>(&matrix(0, 0));
+  const char* start = reinterpret_cast<const char*>(&first(0, 0));
+  return data >= start && data < start + bytes;
+}
+
+TEST(MatrixArena, Subtest_1) {
+  S21MatrixArena arena(4096);
+  EXPECT_EQ(S21MatrixArena::Current(), nullptr);
+  {
+    S21MatrixArenaScope scope(arena);
+    EXPECT_EQ(S21MatrixArena::Current(), &arena);
+    S21Matrix first(2, 2), second(3, 3);
+    for (const S21Matrix* matrix : {&first, &second}) {
+      std::uintptr_t address = reinterpret_cast<std::uintptr_t>(matrix->Data());
+      EXPECT_EQ(address % kS21SimdAlignment, 0u);
+    }
+    EXPECT_EQ(arena.GetBytesInUse(), 64u + 128u);
+    EXPECT_EQ(arena.GetBytesReserved(), 4096u);
+    EXPECT_EQ(IsInside(second, first, 4096), true);
+    EXPECT_EQ(second(2, 2), 0);
+  }
+  EXPECT_EQ(S21MatrixArena::Current(), nullptr);
+  EXPECT_EQ(arena.GetBytesInUse(), 64u);
+
+  arena.Reset();
+  EXPECT_EQ(arena.GetBytesInUse(), 0u);
+  EXPECT_EQ(arena.GetBytesReserved(), 4096u);
+}
+
+TEST(MatrixArena, Subtest_2) {
+  S21MatrixArena arena(1024);
+  S21MatrixArenaScope scope(arena);
+  S21Matrix first(4, 4);
+  const double* data = &first(0, 0);
+  for (int i = 0; i < 100; i++) {
+    S21Matrix temporary(4, 4);
+    EXPECT_EQ(&temporary(0, 0), data + 16);
+  }
+  S21Matrix large(40, 40);
+  EXPECT_EQ(arena.GetBytesReserved(), 1024u + 40 * 40 * sizeof(double));
+  S21Matrix small(2, 2);
+  EXPECT_EQ(arena.GetBytesReserved(), 2048u + 40 * 40 * sizeof(double));
+}
+
+TEST(MatrixArena, Subtest_3) {
+  S21Matrix outside(3, 3);
+  for (int i = 0; i < 3; i++) outside(i, i) = i + 1;
+  outside(0, 2) = 5;
+  S21MatrixArena arena;
+  S21Matrix result;
+  {
+    S21MatrixArenaScope scope(arena);
+    S21Matrix inverse = (outside + outside.Transpose()).InverseMatrix();
+    S21Matrix product = inverse * outside;
+    product.SetCols(4);
+    product += outside.Transpose() * product;
+    result = S21Matrix(product);
+    EXPECT_EQ(IsInside(result, inverse, arena.GetBytesReserved()), true);
+    {
+      S21MatrixArena nested(256);
+      S21MatrixArenaScope nested_scope(nested);
+      EXPECT_EQ(S21MatrixArena::Current(), &nested);
+    }
+    EXPECT_EQ(S21MatrixArena::Current(), &arena);
+  }
+  EXPECT_EQ(result.GetCols(), 4);
+}
+
+TEST(MatrixArena, Subtest_4) {
+  S21Matrix first(3, 3), second(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      first(i, j) = i * 3 + j + (i == j ? 10 : 0);
+      second(i, j) = i - j;
+    }
+  }
+  S21Matrix expected = (first * second + first) * first.InverseMatrix();
+
+  S21MatrixArena arena;
+  S21Matrix result(1, 1);
+  {
+    S21MatrixArenaScope scope(arena);
+    result = (first * second + first) * first.InverseMatrix();
+  }
+  EXPECT_EQ(result.EqMatrix(expected), true);
+
+  S21Matrix heap_copy = result;
+  EXPECT_EQ(IsInside(heap_copy, result, arena.GetBytesReserved()), false);
+  EXPECT_EQ(heap_copy.EqMatrix(expected), true);
+}
+
+TEST(MatrixArena, Subtest_5) {
+  S21Matrix rows(2, 2), cols(2, 2), appended(1, 2), assigned(2, 2);
+  S21Matrix product(2, 3), transposed(2, 3), expression(2, 2);
+  {
+    S21MatrixArena arena;
+    S21MatrixArenaScope scope(arena);
+    S21Matrix marker(1, 1), other(3, 3);
+    other(0, 0) = 1;
+    rows.SetRows(64);
+    cols.SetCols(64);
+    double row[] = {1, 2};
+    for (int i = 0; i < 64; i++) {
+      appended.AppendRow(S21Span<const double>(row, 2));
+    }
+    assigned = other;
+    product.MulMatrix(other);
+    transposed.TransposeInPlace();
+    expression = other.Lazy() + other;
+    std::size_t bytes = arena.GetBytesReserved();
+    for (const S21Matrix* matrix : {&rows, &cols, &appended, &assigned,
+                                    &product, &transposed, &expression}) {
+      EXPECT_EQ(IsInside(*matrix, marker, bytes), false);
+    }
+  }
+  rows(63, 1) = 5;
+  cols(1, 63) = 5;
+  EXPECT_EQ(appended(64, 1), 2);
+  EXPECT_EQ(assigned(0, 0), 1);
+  EXPECT_EQ(product.GetCols(), 3);
+  EXPECT_EQ(transposed.GetRows(), 3);
+  EXPECT_EQ(expression(0, 0), 2);
+}
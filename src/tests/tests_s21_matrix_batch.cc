@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_matrix_batch.h"
+#include "../s21_simd.h"
+#include "s21_test_helpers.h"
+
+static const S21SimdLevel kBatchLevels[] = {
+    S21SimdLevel::kScalar, S21SimdLevel::kSse2, S21SimdLevel::kAvx2,
+    S21SimdLevel::kAvx512};
+
+// Square matrices get a dominant diagonal: the batched inverse and
+// determinant need well-conditioned input, which MakeMatrix does not promise.
+static S21Matrix MakeBatchMatrix(int rows, int cols, int seed) {
+  S21Matrix matrix = MakeMatrix(rows, cols, seed);
+  if (rows == cols) {
+    for (int i = 0; i < rows; i++) matrix(i, i) += (seed % 3 + 1) * rows;
+  }
+  return matrix;
+}
+
+static S21MatrixBatch MakeBatch(int count, int rows, int cols, int seed) {
+  S21MatrixBatch batch(count, rows, cols);
+  for (int b = 0; b < count; b++) {
+    batch.SetMatrix(b, MakeBatchMatrix(rows, cols, seed + b));
+  }
+  return batch;
+}
+
+TEST(MatrixBatch, Subtest_1) {
+  S21MatrixBatch batch = MakeBatch(3, 2, 3, 5);
+  EXPECT_EQ(batch.GetCount(), 3);
+  EXPECT_EQ(batch.GetRows(), 2);
+  EXPECT_EQ(batch.GetCols(), 3);
+  EXPECT_EQ(batch.GetMatrix(1).EqMatrix(MakeBatchMatrix(2, 3, 6)), true);
+
+  batch(2, 1, 2) = 42;
+  EXPECT_EQ(batch.GetMatrix(2)(1, 2), 42);
+  EXPECT_THROW(batch(3, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch(0, 2, 0), std::out_of_range);
+  EXPECT_THROW(batch.GetMatrix(-1), std::out_of_range);
+  EXPECT_THROW(batch.SetMatrix(0, S21Matrix(3, 2)), std::logic_error);
+  EXPECT_THROW(S21MatrixBatch(0, 2, 2), std::logic_error);
+  EXPECT_THROW(S21MatrixBatch(2, 0, 2), std::logic_error);
+}
+
+TEST(MatrixBatch, Subtest_2) {
+  for (S21SimdLevel level : kBatchLevels) {
+    S21SetSimdLevel(level);
+    for (int count : {1, 7, 19}) {
+      S21MatrixBatch left = MakeBatch(count, 3, 4, 1);
+      S21MatrixBatch right = MakeBatch(count, 4, 2, 9);
+      S21MatrixBatch product = left.BatchMul(right);
+      EXPECT_EQ(product.GetRows(), 3);
+      EXPECT_EQ(product.GetCols(), 2);
+      for (int b = 0; b < count; b++) {
+        EXPECT_EQ(product.GetMatrix(b).EqMatrix(left.GetMatrix(b) *
+                                                right.GetMatrix(b)),
+                  true);
+      }
+      EXPECT_THROW(left.BatchMul(left), std::logic_error);
+      EXPECT_THROW(left.BatchMul(MakeBatch(count + 1, 4, 2, 0)),
+                   std::logic_error);
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(MatrixBatch, Subtest_3) {
+  for (S21SimdLevel level : kBatchLevels) {
+    S21SetSimdLevel(level);
+    for (int size : {1, 2, 4, 8}) {
+      S21MatrixBatch batch = MakeBatch(13, size, size, 3);
+      // Reversing the rows of diagonally dominant matrices forces exchanges.
+      for (int b = 0; b < 13; b++) {
+        for (int i = 0; i < size / 2; i++) {
+          for (int j = 0; j < size; j++) {
+            std::swap(batch(b, i, j), batch(b, size - 1 - i, j));
+          }
+        }
+      }
+      S21MatrixBatch inverse = batch.BatchInverse();
+      std::vector<double> determinants = batch.BatchDeterminant();
+      ASSERT_EQ(determinants.size(), 13u);
+      for (int b = 0; b < 13; b++) {
+        S21Matrix matrix = batch.GetMatrix(b);
+        EXPECT_EQ(inverse.GetMatrix(b).EqMatrix(matrix.InverseMatrix()), true);
+        EXPECT_NEAR(determinants[b], matrix.Determinant(),
+                    1e-9 * fabs(matrix.Determinant()));
+      }
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(MatrixBatch, Subtest_4) {
+  S21MatrixBatch batch = MakeBatch(5, 3, 3, 2);
+  batch.SetMatrix(3, S21Matrix(3, 3));
+  for (int j = 0; j < 3; j++) {
+    batch(1, 2, j) = batch(1, 0, j) * 2;
+  }
+  std::vector<double> determinants = batch.BatchDeterminant();
+  EXPECT_EQ(determinants[3], 0);
+  EXPECT_NEAR(determinants[1], 0, 1e-12);
+  EXPECT_THROW(batch.BatchInverse(), std::logic_error);
+  EXPECT_THROW(MakeBatch(2, 2, 3, 0).BatchInverse(), std::logic_error);
+  EXPECT_THROW(MakeBatch(2, 2, 3, 0).BatchDeterminant(), std::logic_error);
+}
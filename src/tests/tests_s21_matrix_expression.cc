@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+#include "s21_test_helpers.h"
+
+TEST(MatrixExpression, Subtest_1) {
+  S21Matrix first = MakeMatrix(4, 6, 1), second = MakeMatrix(4, 6, 2),
+            third = MakeMatrix(4, 6, 3);
+  S21Matrix result = first + second - third * 2.0;
+
+  ASSERT_EQ(result.GetRows(), 4);
+  ASSERT_EQ(result.GetCols(), 6);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 6; j++) {
+      EXPECT_EQ(result(i, j), first(i, j) + second(i, j) - 2 * third(i, j));
+    }
+  }
+  EXPECT_EQ(result.EqMatrix(0.5 * (first + second) * 2 - third - third), true);
+}
+
+TEST(MatrixExpression, Subtest_2) {
+  S21Matrix first = MakeMatrix(3, 3, 1), second = MakeMatrix(3, 3, 2);
+  S21Matrix expected(first);
+  expected.SumMatrix(second);
+
+  first = first + second;
+  EXPECT_EQ(first.EqMatrix(expected), true);
+
+  first += second * 3 - second;
+  expected.SumMatrix(second);
+  expected.SumMatrix(second);
+  EXPECT_EQ(first.EqMatrix(expected), true);
+
+  first -= second + second;
+  expected.SubMatrix(second);
+  expected.SubMatrix(second);
+  EXPECT_EQ(first.EqMatrix(expected), true);
+}
+
+TEST(MatrixExpression, Subtest_3) {
+  S21Matrix first = MakeMatrix(2, 5, 1), second = MakeMatrix(2, 5, 2);
+  S21Matrix result;
+  result = first - second;
+  EXPECT_EQ(result.GetRows(), 2);
+  EXPECT_EQ(result.GetCols(), 5);
+  EXPECT_EQ(result(1, 4), first(1, 4) - second(1, 4));
+
+  S21Matrix other = MakeMatrix(5, 2, 3);
+  EXPECT_ANY_THROW(first + other);
+  EXPECT_ANY_THROW(first - other * 2);
+  EXPECT_ANY_THROW(result += other * 2);
+  EXPECT_ANY_THROW(result -= other + other);
+}
+
+TEST(MatrixExpression, Subtest_4) {
+  S21Matrix first = MakeMatrix(3, 4, 1), second = MakeMatrix(4, 2, 2);
+  S21Matrix doubled(first);
+  doubled.MulNumber(2);
+  S21Matrix expected = doubled * second;
+
+  EXPECT_EQ(expected.EqMatrix((first + first) * second), true);
+  EXPECT_EQ(expected.EqMatrix(first * (second + second)), true);
+  EXPECT_EQ(expected.EqMatrix((first * 2) * (second * 1)), true);
+}
+
+TEST(MatrixExpression, Subtest_5) {
+  S21Matrix first = MakeMatrix(3, 4, 1), second = MakeMatrix(3, 4, 2);
+
+  S21Matrix temporary(first);
+  const double* storage = &temporary(0, 0);
+  S21Matrix sum = std::move(temporary) + second;
+  EXPECT_EQ(&sum(0, 0), storage);
+  EXPECT_EQ(sum(2, 3), first(2, 3) + second(2, 3));
+
+  storage = &sum(0, 0);
+  S21Matrix difference = second - std::move(sum);
+  EXPECT_EQ(&difference(0, 0), storage);
+  EXPECT_EQ(difference(1, 2), -first(1, 2));
+
+  storage = &difference(0, 0);
+  S21Matrix scaled = 3 * (std::move(difference) * 2.0 - first + second);
+  EXPECT_EQ(&scaled(0, 0), storage);
+  EXPECT_EQ(scaled(0, 1), 3 * (-2 * first(0, 1) - first(0, 1) + second(0, 1)));
+}
+
+TEST(MatrixExpression, Subtest_6) {
+  S21Matrix first = MakeMatrix(2, 3, 1), second = MakeMatrix(3, 2, 2),
+            third = MakeMatrix(2, 2, 3);
+  S21Matrix product = first * second;
+  S21Matrix expected(product);
+  expected.SumMatrix(third);
+
+  EXPECT_EQ(expected.EqMatrix(first * second + third), true);
+  EXPECT_EQ(expected.EqMatrix(third + first * second), true);
+  EXPECT_EQ(expected.EqMatrix(first * second + (third * 1 + third * 0)), true);
+  EXPECT_EQ(expected.EqMatrix((first * second) - (third * -1)), true);
+  EXPECT_EQ(expected.EqMatrix(S21Matrix(product) + S21Matrix(third)), true);
+  EXPECT_EQ(product.EqMatrix(S21Matrix(expected) - S21Matrix(third)), true);
+  EXPECT_ANY_THROW(first * second + first);
+  EXPECT_ANY_THROW(first - first * second);
+}
+
+TEST(MatrixExpression, Subtest_7) {
+  S21Matrix first = MakeMatrix(3, 2, 1), second = MakeMatrix(3, 2, 2);
+  S21Matrix expected(first);
+  expected.SumMatrix(second);
+
+  EXPECT_EQ((first + second) == expected, true);
+  EXPECT_EQ((first + second).EqMatrix(expected), true);
+  EXPECT_EQ((first + second)(2, 1), expected(2, 1));
+  EXPECT_EQ((first + second).Transpose().EqMatrix(expected.Transpose()), true);
+  EXPECT_EQ((first - second)(1, 0), first(1, 0) - second(1, 0));
+  EXPECT_EQ((first * 2.0).GetRows(), 3);
+
+  auto sum = first + second;
+  first = S21Matrix(8, 8);
+  S21Matrix result = sum;
+  EXPECT_EQ(result.EqMatrix(expected), true);
+}
+
+TEST(MatrixExpression, Subtest_8) {
+  S21Matrix first = MakeMatrix(4, 3, 1), second = MakeMatrix(4, 3, 2),
+            third = MakeMatrix(4, 3, 3);
+  S21Matrix expected = first + second - third * 2.0;
+
+  S21Matrix result = first.Lazy() + second - third.Lazy() * 2.0;
+  EXPECT_EQ(result.EqMatrix(expected), true);
+  EXPECT_EQ((first.Lazy() + second - 2.0 * third.Lazy()).Eval() == expected,
+            true);
+  S21Matrix halves = (0.5 * first.Lazy() + first.Lazy() * 0.5).Eval();
+  EXPECT_EQ(halves.EqMatrix(first), true);
+
+  result -= first.Lazy() + second;
+  EXPECT_EQ(result.EqMatrix(third * -2.0), true);
+  result += third.Lazy() * 2.0 - third;
+  EXPECT_EQ(result.EqMatrix(third * -1.0), true);
+  EXPECT_ANY_THROW(first.Lazy() + MakeMatrix(3, 4, 1));
+}
+
+TEST(MatrixExpression, Subtest_9) {
+  S21Matrix padded = MakeMatrix(5, 7, 4), compact = MakeMatrix(5, 5, 5);
+  padded.SetCols(5);
+  S21Matrix copy(padded);
+
+  S21Matrix sum = padded + compact, difference = compact - padded;
+  S21Matrix scaled = padded * 3.0;
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      EXPECT_EQ(sum(i, j), copy(i, j) + compact(i, j));
+      EXPECT_EQ(difference(i, j), compact(i, j) - copy(i, j));
+      EXPECT_EQ(scaled(i, j), 3 * copy(i, j));
+    }
+  }
+  EXPECT_EQ(sum.GetStride(), 5);
+}
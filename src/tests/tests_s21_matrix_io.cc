@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "../s21_matrix_io.h"
+#include "s21_test_helpers.h"
+
+static std::string MatrixFilePath(const std::string& name) {
+  return testing::TempDir() + "s21_matrix_io_" + name + ".bin";
+}
+
+// Large values with non-terminating binary fractions, so that the == checks
+// below catch any bit lost on the way to disk and back.
+static S21Matrix MakeIoMatrix(int rows, int cols) {
+  S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) matrix(i, j) = i * 1000.25 - j / 3.0;
+  }
+  return matrix;
+}
+
+TEST(MatrixIo, Subtest_1) {
+  std::string path = MatrixFilePath("1");
+  for (int cols : {1, 5, 8, 13}) {
+    S21Matrix matrix = MakeIoMatrix(7, cols);
+    matrix.Save(path);
+    S21Matrix loaded = S21Matrix::Load(path);
+    EXPECT_EQ(loaded.GetRows(), 7);
+    EXPECT_EQ(loaded.GetCols(), cols);
+    EXPECT_EQ(loaded == matrix, true);
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(static_cast<long>(file.tellg()),
+              static_cast<long>(sizeof(S21MatrixFileHeader) +
+                                7 * cols * sizeof(double)));
+  }
+  std::remove(path.c_str());
+}
+
+TEST(MatrixIo, Subtest_2) {
+  std::string path = MatrixFilePath("2");
+  S21Matrix matrix = MakeMatrix(6, 9, 1);
+  S21SaveMatrix(matrix.T().Block(1, 2, 5, 3), path);
+  S21Matrix loaded = S21Matrix::Load(path);
+  EXPECT_EQ(loaded.EqMatrix(matrix.T().Block(1, 2, 5, 3)), true);
+  std::remove(path.c_str());
+}
+
+TEST(MatrixIo, Subtest_3) {
+  std::string path = MatrixFilePath("3");
+  S21Matrix matrix = MakeIoMatrix(9, 11);
+  matrix.Save(path);
+  {
+    S21MappedMatrix mapped(path);
+    EXPECT_EQ(mapped.GetRows(), 9);
+    EXPECT_EQ(mapped.GetCols(), 11);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.Data()) % 64, 0u);
+    EXPECT_EQ(mapped(8, 10), matrix(8, 10));
+    EXPECT_THROW(mapped(9, 0), std::out_of_range);
+    EXPECT_EQ(matrix.EqMatrix(mapped.View()), true);
+    EXPECT_EQ(mapped.ToMatrix() == matrix, true);
+
+    S21Matrix product = mapped.View() * matrix.T();
+    EXPECT_EQ(product.EqMatrix(matrix * matrix.Transpose()), true);
+
+    S21MappedMatrix moved(std::move(mapped));
+    EXPECT_EQ(moved(3, 4), matrix(3, 4));
+    EXPECT_EQ(mapped.GetRows(), 0);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(MatrixIo, Subtest_4) {
+  std::string path = MatrixFilePath("4");
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  EXPECT_THROW(S21MappedMatrix mapped(path), std::runtime_error);
+
+  std::ofstream(path, std::ios::binary) << "not a matrix file at all";
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+
+  MakeMatrix(4, 4, 1).Save(path);
+  std::string contents;
+  {
+    std::ifstream file(path, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), {});
+  }
+  std::ofstream(path, std::ios::binary | std::ios::trunc)
+      << contents.substr(0, contents.size() - 8);
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  EXPECT_THROW(S21MappedMatrix mapped(path), std::runtime_error);
+
+  contents[8] = 2;
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  std::remove(path.c_str());
+}
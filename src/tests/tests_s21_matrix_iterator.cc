@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_matrix_iterator.h"
+#include "../s21_matrix_oop.h"
+
+static S21Matrix MakeMatrix(int rows, int cols) {
+  S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) matrix(i, j) = i * cols + j;
+  }
+  return matrix;
+}
+
+TEST(MatrixIterator, Access_1) {
+  S21Matrix matrix = MakeMatrix(3, 4);
+  const S21Matrix& constant = matrix;
+  matrix.At(1, 2) = -1;
+  EXPECT_DOUBLE_EQ(matrix(1, 2), -1);
+  EXPECT_DOUBLE_EQ(constant.At(2, 3), 11);
+  EXPECT_EQ(matrix.GetStride(), 4);
+  EXPECT_DOUBLE_EQ(constant.Data()[2 * matrix.GetStride() + 1], 9);
+
+  S21Span<double> row = matrix.Row(2);
+  EXPECT_EQ(row.size(), 4u);
+  EXPECT_FALSE(row.empty());
+  row[0] = 42;
+  EXPECT_DOUBLE_EQ(matrix(2, 0), 42);
+  S21Span<const double> const_row = constant.Row(0);
+  EXPECT_DOUBLE_EQ(std::accumulate(const_row.begin(), const_row.end(), 0.0),
+                   6);
+}
+
+TEST(MatrixIterator, Access_2) {
+  S21Matrix matrix(2, 2);
+  const S21Matrix& constant = matrix;
+  EXPECT_THROW(matrix.Row(2), std::out_of_range);
+  EXPECT_THROW(constant.Row(-1), std::out_of_range);
+}
+
+TEST(MatrixIterator, Algorithms_1) {
+  S21Matrix matrix = MakeMatrix(5, 7);
+  EXPECT_EQ(std::distance(matrix.begin(), matrix.end()), 35);
+  EXPECT_DOUBLE_EQ(std::reduce(matrix.cbegin(), matrix.cend()), 595);
+
+  S21Matrix result(5, 7);
+  std::transform(matrix.begin(), matrix.end(), result.begin(),
+                 [](double value) { return 2 * value; });
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 7; j++) {
+      EXPECT_DOUBLE_EQ(result(i, j), 2 * matrix(i, j));
+    }
+  }
+
+  std::reverse(result.begin(), result.end());
+  EXPECT_DOUBLE_EQ(result(0, 0), 68);
+  std::sort(result.begin(), result.end());
+  EXPECT_TRUE(std::is_sorted(result.cbegin(), result.cend()));
+  EXPECT_DOUBLE_EQ(result(4, 6), 68);
+  EXPECT_EQ(std::lower_bound(result.begin(), result.end(), 30) - result.begin(),
+            15);
+}
+
+TEST(MatrixIterator, Arithmetic_1) {
+  S21Matrix matrix = MakeMatrix(4, 3);
+  S21Matrix::iterator first = matrix.begin();
+  S21Matrix::iterator last = matrix.end();
+  EXPECT_DOUBLE_EQ(*(first + 5), 5);
+  EXPECT_DOUBLE_EQ(first[7], 7);
+  EXPECT_DOUBLE_EQ(*(last - 1), 11);
+  EXPECT_DOUBLE_EQ(*(last - 4), 8);
+  EXPECT_DOUBLE_EQ(*(2 + first), 2);
+
+  S21Matrix::iterator middle = first + 6;
+  EXPECT_EQ(middle - first, 6);
+  EXPECT_EQ(first - middle, -6);
+  middle -= 4;
+  EXPECT_DOUBLE_EQ(*middle, 2);
+  EXPECT_DOUBLE_EQ(*++middle, 3);
+  EXPECT_DOUBLE_EQ(*--middle, 2);
+  EXPECT_DOUBLE_EQ(*middle++, 2);
+  EXPECT_DOUBLE_EQ(*middle--, 3);
+  EXPECT_TRUE(first < middle);
+  EXPECT_TRUE(middle <= middle);
+  EXPECT_TRUE(last > middle);
+  EXPECT_TRUE(last >= last);
+  EXPECT_TRUE(first != middle);
+
+  S21Matrix::const_iterator constant = middle;
+  EXPECT_TRUE(constant == matrix.cbegin() + 2);
+}
+
+TEST(MatrixIterator, Arithmetic_2) {
+  S21Matrix matrix = MakeMatrix(2, 2);
+  S21Matrix moved = std::move(matrix);
+  EXPECT_TRUE(matrix.begin() == matrix.end());
+  EXPECT_EQ(matrix.end() - matrix.begin(), 0);
+  EXPECT_DOUBLE_EQ(std::reduce(moved.begin(), moved.end()), 6);
+
+  // Three rows of two values, each padded to a stride of three.
+  double padded[] = {0, 1, -1, 2, 3, -1, 4, 5, -1};
+  S21MatrixIterator<double> first(padded, 0, 2, 3), last(padded + 9, 0, 2, 3);
+  EXPECT_EQ(last - first, 6);
+  EXPECT_DOUBLE_EQ(std::reduce(first, last), 15);
+  EXPECT_DOUBLE_EQ(*(first + 3), 3);
+  EXPECT_DOUBLE_EQ(*(last - 3), 3);
+  EXPECT_DOUBLE_EQ(*--last, 5);
+}
@@ -389,6 +389,50 @@ TEST(Transpose, Subtest_1) {
   EXPECT_EQ(first.EqMatrix(third.Transpose()), true);
 }
 
+TEST(Transpose, Subtest_2) {
+  for (int rows : {1, 5, 33, 70}) {
+    for (int cols : {1, 3, 32, 67}) {
+      S21Matrix matrix(rows, cols);
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) matrix(i, j) = i * 1000 + j;
+      }
+      S21Matrix transposed = matrix.Transpose();
+      ASSERT_EQ(transposed.GetRows(), cols);
+      ASSERT_EQ(transposed.GetCols(), rows);
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+          ASSERT_EQ(transposed(j, i), matrix(i, j));
+        }
+      }
+    }
+  }
+}
+
+TEST(TransposeInPlace, Subtest_1) {
+  for (int size : {1, 2, 7, 32, 33, 100}) {
+    S21Matrix matrix(size, size);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) matrix(i, j) = i * 1000 + j;
+    }
+    S21Matrix expected = matrix.Transpose();
+    const double* data = &matrix(0, 0);
+    matrix.TransposeInPlace();
+    EXPECT_EQ(&matrix(0, 0), data);
+    EXPECT_EQ(matrix.EqMatrix(expected), true);
+  }
+}
+
+TEST(TransposeInPlace, Subtest_2) {
+  S21Matrix matrix(2, 3);
+  matrix(0, 2) = 5;
+  matrix(1, 0) = 7;
+  matrix.TransposeInPlace();
+  EXPECT_EQ(matrix.GetRows(), 3);
+  EXPECT_EQ(matrix.GetCols(), 2);
+  EXPECT_EQ(matrix(2, 0), 5);
+  EXPECT_EQ(matrix(0, 1), 7);
+}
+
 TEST(CalcComplement, Subtest_1) {
   S21Matrix first, second;
 
@@ -474,6 +518,90 @@ TEST(CalcComplement, Subtest_5) {
   EXPECT_ANY_THROW(second.CalcComplements());
 }
 
+static S21Matrix ReferenceComplements(const S21Matrix& matrix) {
+  int size = matrix.GetRows();
+  S21Matrix result(size, size);
+  if (size == 1) {
+    result(0, 0) = 1;
+    return result;
+  }
+  S21Matrix minor(size - 1, size - 1);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      for (int row = 0, minor_row = 0; row < size; row++) {
+        if (row == i) continue;
+        for (int col = 0, minor_col = 0; col < size; col++) {
+          if (col != j) minor(minor_row, minor_col++) = matrix(row, col);
+        }
+        minor_row++;
+      }
+      result(i, j) = ((i + j) % 2 ? -1 : 1) * minor.Determinant();
+    }
+  }
+  return result;
+}
+
+TEST(CalcComplement, Subtest_6) {
+  for (int size = 2; size <= 7; size++) {
+    S21Matrix first(size, size);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        first(i, j) = ((i * 5 + j * 3 + size) % 7 - 3) / 2.0;
+      }
+      first(i, i) += 1;
+    }
+    EXPECT_EQ(ReferenceComplements(first).EqMatrix(first.CalcComplements()),
+              true);
+  }
+}
+
+TEST(CalcComplement, Subtest_7) {
+  S21Matrix first(2, 2);
+  first(0, 1) = 1;
+  EXPECT_EQ(ReferenceComplements(first).EqMatrix(first.CalcComplements()),
+            true);
+
+  for (int size = 3; size <= 6; size++) {
+    S21Matrix rank_one_less(size, size), rank_two_less(size, size);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        rank_one_less(i, j) = ((i * 3 + j * 7) % 5 - 2) + (i == j ? 4 : 0);
+      }
+    }
+    for (int j = 0; j < size; j++) {
+      rank_one_less(size - 1, j) = rank_one_less(0, j) - 2 * rank_one_less(1, j);
+    }
+    rank_two_less = rank_one_less;
+    for (int j = 0; j < size; j++) {
+      rank_two_less(size - 2, j) = 3 * rank_one_less(0, j);
+    }
+
+    EXPECT_EQ(ReferenceComplements(rank_one_less)
+                  .EqMatrix(rank_one_less.CalcComplements()),
+              true);
+    EXPECT_EQ(ReferenceComplements(rank_two_less)
+                  .EqMatrix(rank_two_less.CalcComplements()),
+              true);
+  }
+}
+
+TEST(CalcComplement, Subtest_8) {
+  const int size = 120;
+  S21Matrix first(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) first(i, j) = ((i * 7 + j * 11) % 9) / 9.0;
+    first(i, i) += 2;
+  }
+  S21Matrix complements = first.CalcComplements();
+  S21Matrix product = first * complements.Transpose();
+  double det = first.Determinant();
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      EXPECT_NEAR(product(i, j), i == j ? det : 0, 1e-9 * fabs(det));
+    }
+  }
+}
+
 TEST(Determinant, Subtest_1) {
   S21Matrix first(5, 5);
 
@@ -547,6 +675,82 @@ TEST(Determinant, Subtest_4) {
   EXPECT_ANY_THROW(second.Determinant());
 }
 
+static double ReferenceDeterminant(const S21Matrix& matrix) {
+  int size = matrix.GetRows();
+  if (size == 1) return matrix(0, 0);
+  double result = 0;
+  S21Matrix minor(size - 1, size - 1);
+  for (int j = 0; j < size; j++) {
+    for (int i = 1; i < size; i++) {
+      for (int k = 0, minor_col = 0; k < size; k++) {
+        if (k != j) minor(i - 1, minor_col++) = matrix(i, k);
+      }
+    }
+    result += (j % 2 ? -1 : 1) * matrix(0, j) * ReferenceDeterminant(minor);
+  }
+  return result;
+}
+
+TEST(Determinant, Subtest_5) {
+  for (int size = 1; size <= 8; size++) {
+    S21Matrix first(size, size);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        first(i, j) = ((i * 7 + j * 13 + size) % 11 - 5) / 2.0;
+      }
+    }
+    double expected = ReferenceDeterminant(first);
+    EXPECT_NEAR(first.Determinant(), expected,
+                S21_MATRIX_OOP_EPS * std::max(1.0, fabs(expected)));
+  }
+}
+
+TEST(Determinant, Subtest_6) {
+  S21Matrix first(4, 4);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) first(i, j) = i + j;
+  }
+  EXPECT_NEAR(first.Determinant(), 0, S21_MATRIX_OOP_EPS);
+
+  S21Matrix second(3, 3);
+  EXPECT_EQ(second.Determinant(), 0);
+}
+
+TEST(Determinant, Subtest_7) {
+  const int size = 300;
+  S21Matrix first(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = i; j < size; j++) first(i, j) = (i == j) ? 100.0 + i : 0.5;
+  }
+  for (int j = 0; j < size; j++) std::swap(first(0, j), first(size - 1, j));
+
+  double expected_log = 0;
+  for (int i = 0; i < size; i++) expected_log += log(100.0 + i);
+
+  int sign = 0;
+  double log_det = first.LogAbsDeterminant(sign);
+  EXPECT_EQ(sign, -1);
+  EXPECT_NEAR(log_det, expected_log, 1e-9 * expected_log);
+  EXPECT_EQ(std::isinf(first.Determinant()), true);
+}
+
+TEST(Determinant, Subtest_8) {
+  S21Matrix first;
+  first(0, 0) = -2;
+  first(1, 1) = 3;
+  first(2, 2) = 0.5;
+  int sign = 0;
+  EXPECT_NEAR(first.LogAbsDeterminant(sign), log(3), S21_MATRIX_OOP_EPS);
+  EXPECT_EQ(sign, -1);
+
+  first(2, 2) = 0;
+  EXPECT_EQ(std::isinf(first.LogAbsDeterminant(sign)), true);
+  EXPECT_EQ(sign, 0);
+
+  S21Matrix second(2, 3);
+  EXPECT_ANY_THROW(second.LogAbsDeterminant(sign));
+}
+
 TEST(InverseMatrix, Subtest_1) {
   S21Matrix first(5, 5), second(5, 5);
 
@@ -630,6 +834,47 @@ TEST(InverseMatrix, Subtest_4) {
   EXPECT_ANY_THROW(first.InverseMatrix());
 }
 
+TEST(InverseMatrix, Subtest_5) {
+  for (int size : {1, 7, 64, 150}) {
+    S21Matrix first(size, size), identity(size, size);
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        first(i, j) = ((i * 17 + j * 5) % 13 - 6) / 3.0;
+      }
+      first(i, i) += size;
+      identity(i, i) = 1;
+    }
+    S21Matrix inverse = first.InverseMatrix();
+    EXPECT_EQ(identity.EqMatrix(first * inverse), true);
+    EXPECT_EQ(identity.EqMatrix(inverse * first), true);
+  }
+}
+
+TEST(InverseMatrix, Subtest_6) {
+  S21Matrix first;
+  first(0, 0) = 0.1;
+  first(0, 1) = 0.2;
+  first(0, 2) = 0.3;
+  first(1, 0) = 0.4;
+  first(1, 1) = 0.5;
+  first(1, 2) = 0.6;
+  first(2, 0) = 0.7;
+  first(2, 1) = 0.8;
+  first(2, 2) = 0.9;
+  EXPECT_ANY_THROW(first.InverseMatrix());
+
+  S21Matrix second(4, 4);
+  EXPECT_ANY_THROW(second.InverseMatrix());
+
+  S21Matrix third(2, 2);
+  third(0, 0) = 1e-12;
+  third(1, 1) = 2e-12;
+  S21Matrix expected(2, 2);
+  expected(0, 0) = 1;
+  expected(1, 1) = 1;
+  EXPECT_EQ(expected.EqMatrix(third * third.InverseMatrix()), true);
+}
+
 TEST(OperatorsSum, Subtest_1) {
   S21Matrix first(2, 3), second(2, 3), third(2, 3);
 
@@ -857,6 +1102,94 @@ TEST(GettersAndSetters, Subtest_3) {
   EXPECT_EQ(first.GetCols(), 4);
 }
 
+TEST(GettersAndSetters, Subtest_4) {
+  S21Matrix first(1, 3);
+  first(0, 1) = 1;
+  const double* data = first.Data();
+  first.SetCols(2);
+  first.SetRows(1);
+  EXPECT_EQ(first.Data(), data);
+  EXPECT_EQ(first.GetStride(), 3);
+  EXPECT_EQ(first(0, 1), 1);
+
+  first.SetCols(3);
+  EXPECT_EQ(first.Data(), data);
+  EXPECT_EQ(first(0, 2), 0);
+
+  first.Reserve(100);
+  EXPECT_EQ(first.GetCapacity(), 100);
+  data = first.Data();
+  for (int i = 1; i < 100; i++) first.SetRows(i + 1);
+  EXPECT_EQ(first.Data(), data);
+  EXPECT_EQ(first(99, 2), 0);
+  EXPECT_EQ(first(0, 1), 1);
+
+  first.SetRows(2);
+  first.ShrinkToFit();
+  EXPECT_EQ(first.GetCapacity(), 2);
+  EXPECT_EQ(first(0, 1), 1);
+}
+
+TEST(GettersAndSetters, Subtest_5) {
+  S21Matrix first(1, 2);
+  int reallocations = 0;
+  for (int i = 1; i < 1000; i++) {
+    const double* data = first.Data();
+    double row[] = {1.0 * i, -1.0 * i};
+    first.AppendRow(S21Span<const double>(row, 2));
+    if (first.Data() != data) reallocations++;
+  }
+  EXPECT_EQ(first.GetRows(), 1000);
+  EXPECT_LE(reallocations, 10);
+  EXPECT_GE(first.GetCapacity(), 1000);
+  EXPECT_EQ(first(0, 0), 0);
+  EXPECT_EQ(first(999, 1), -999);
+
+  first.AppendRows(first);
+  EXPECT_EQ(first.GetRows(), 2000);
+  EXPECT_EQ(first(1999, 0), 999);
+  first.AppendRow(first.Row(1999));
+  EXPECT_EQ(first(2000, 1), -999);
+  EXPECT_ANY_THROW(first.AppendRows(S21Matrix(1, 3)));
+  EXPECT_ANY_THROW(first.AppendRow(S21Span<const double>()));
+}
+
+TEST(GettersAndSetters, Subtest_6) {
+  S21Matrix padded(3, 5);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 5; j++) padded(i, j) = (i + 1) * (j + 2) % 7 + i;
+  }
+  padded.SetCols(3);
+  S21Matrix compact = padded;
+  EXPECT_EQ(padded.GetStride(), 5);
+  EXPECT_EQ(compact.GetStride(), 3);
+
+  EXPECT_TRUE(padded.EqMatrix(compact));
+  EXPECT_TRUE((padded * padded).EqMatrix(compact * compact));
+  EXPECT_TRUE(S21Matrix(padded + padded).EqMatrix(compact + compact));
+  EXPECT_TRUE(padded.Transpose().EqMatrix(compact.Transpose()));
+  EXPECT_TRUE(padded.InverseMatrix().EqMatrix(compact.InverseMatrix()));
+  EXPECT_DOUBLE_EQ(padded.Determinant(), compact.Determinant());
+  EXPECT_DOUBLE_EQ(padded.Sum(), compact.Sum());
+  EXPECT_EQ(std::distance(padded.begin(), padded.end()), 9);
+
+  padded.TransposeInPlace();
+  padded.MulNumber(2);
+  compact.TransposeInPlace();
+  compact += compact;
+  EXPECT_TRUE(padded == compact);
+}
+
+TEST(GettersAndSetters, Subtest_7) {
+  S21Matrix first(2, 2);
+  S21Matrix second = std::move(first);
+  EXPECT_ANY_THROW(first.SetRows(3));
+  EXPECT_ANY_THROW(first.SetCols(3));
+  EXPECT_ANY_THROW(first.AppendRow(S21Span<const double>()));
+  EXPECT_EQ(first.GetRows(), 0);
+  EXPECT_EQ(first.GetCols(), 0);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
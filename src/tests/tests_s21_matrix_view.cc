@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+#include "s21_test_helpers.h"
+
+TEST(MatrixView, Subtest_1) {
+  S21Matrix matrix = MakeMatrix(4, 6, 1);
+  S21ConstMatrixView transposed = matrix.T();
+  EXPECT_EQ(transposed.GetRows(), 6);
+  EXPECT_EQ(transposed.GetCols(), 4);
+  EXPECT_EQ(&transposed(5, 3), &matrix(3, 5));
+  EXPECT_EQ(matrix.Transpose().EqMatrix(transposed), true);
+
+  S21ConstMatrixView block = matrix.Block(1, 2, 2, 3);
+  EXPECT_EQ(&block(0, 0), &matrix(1, 2));
+  EXPECT_EQ(&block.T()(2, 1), &matrix(2, 4));
+  EXPECT_EQ(S21Matrix(block)(1, 2), matrix(2, 4));
+
+  EXPECT_THROW(matrix.Block(3, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(matrix.Block(0, 0, 0, 1), std::logic_error);
+  EXPECT_THROW(block(2, 0), std::out_of_range);
+}
+
+TEST(MatrixView, Subtest_2) {
+  S21Matrix first = MakeMatrix(70, 50, 2);
+  S21Matrix second = MakeMatrix(70, 40, 3);
+  S21Matrix expected = first.Transpose() * second;
+  EXPECT_EQ((first.T() * second).EqMatrix(expected), true);
+  EXPECT_EQ((second.T() * first).EqMatrix(expected.Transpose()), true);
+
+  S21Matrix square = MakeMatrix(50, 50, 4);
+  S21Matrix product = square;
+  product.MulMatrix(first.T().Block(0, 0, 50, 50));
+  EXPECT_EQ(product.EqMatrix(square * S21Matrix(first.Block(0, 0, 50, 50))
+                                          .Transpose()),
+            true);
+  EXPECT_THROW(square.MulMatrix(second.T()), std::logic_error);
+}
+
+TEST(MatrixView, Subtest_3) {
+  S21Matrix matrix = MakeMatrix(6, 6, 5);
+  S21Matrix original = matrix;
+  S21Matrix update = MakeMatrix(3, 2, 6);
+
+  matrix.Block(1, 2, 3, 2).SumMatrix(update);
+  matrix.Block(2, 1, 2, 3).T().SubMatrix(update);
+  matrix.Block(0, 0, 2, 2).MulNumber(2);
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 6; j++) {
+      double value = original(i, j);
+      if (i >= 1 && i < 4 && j >= 2 && j < 4) value += update(i - 1, j - 2);
+      if (i >= 2 && i < 4 && j >= 1 && j < 4) value -= update(j - 1, i - 2);
+      if (i < 2 && j < 2) value *= 2;
+      EXPECT_DOUBLE_EQ(matrix(i, j), value);
+    }
+  }
+  EXPECT_THROW(matrix.Block(0, 0, 2, 3).SumMatrix(update), std::logic_error);
+}
+
+TEST(MatrixView, Subtest_4) {
+  S21Matrix left = MakeMatrix(5, 4, 7);
+  S21Matrix right = MakeMatrix(4, 3, 8);
+  S21Matrix target = MakeMatrix(8, 8, 9);
+  S21Matrix expected = target;
+  S21Matrix product = left * right;
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 3; j++) {
+      expected(2 + i, 1 + j) -= 0.5 * product(i, j);
+      expected(1 + j, 2 + i) += product(i, j);
+    }
+  }
+
+  target.Block(2, 1, 5, 3).AddProduct(left, right, -0.5);
+  target.Block(1, 2, 3, 5).T().AddProduct(left, right);
+  EXPECT_EQ(target.EqMatrix(expected), true);
+  EXPECT_THROW(target.Block(0, 0, 5, 4).AddProduct(left, right),
+               std::logic_error);
+
+  S21Matrix square = MakeMatrix(6, 6, 10);
+  expected = square;
+  expected.SumMatrix(square * square);
+  square.Block(0, 0, 6, 6).AddProduct(square, square);
+  EXPECT_EQ(square.EqMatrix(expected), true);
+
+  expected = square;
+  S21Matrix corner = square.Block(0, 0, 3, 3) * square.Block(2, 2, 3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) expected(1 + j, 3 + i) -= corner(i, j);
+  }
+  square.Block(1, 3, 3, 3).T().AddProduct(square.Block(0, 0, 3, 3),
+                                          square.Block(2, 2, 3, 3), -1.0);
+  EXPECT_EQ(square.EqMatrix(expected), true);
+}
+
+TEST(MatrixView, Subtest_5) {
+  S21Matrix matrix = MakeMatrix(3, 3, 10);
+  double data[] = {1, 2, 3, 4, 5, 6};
+  S21ConstMatrixView strided(data, 3, 2, 1, 3);
+  EXPECT_EQ(strided(2, 1), 6);
+  EXPECT_EQ(strided.EqMatrix(S21ConstMatrixView(data, 2, 3, 3, 1).T()), true);
+  EXPECT_EQ(matrix.EqMatrix(matrix.T().T()), true);
+  EXPECT_EQ(matrix.EqMatrix(matrix.Block(0, 0, 2, 3)), false);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+#include "../s21_out_of_core.h"
+#include "s21_test_helpers.h"
+
+static std::string OutOfCorePath(const std::string& name) {
+  return testing::TempDir() + "s21_out_of_core_" + name + ".bin";
+}
+
+TEST(FileMatrix, Subtest_1) {
+  std::string path = OutOfCorePath("file");
+  S21Matrix matrix = MakeMatrix(9, 7, 1);
+  {
+    S21FileMatrix file = S21FileMatrix::Create(path, 9, 7);
+    EXPECT_EQ(file.GetRows(), 9);
+    EXPECT_EQ(file.GetCols(), 7);
+    file.WriteBlock(0, 0, matrix.Block(0, 0, 9, 4));
+    file.WriteBlock(0, 4, matrix.Block(0, 4, 9, 3));
+    EXPECT_THROW(file.WriteBlock(5, 5, matrix.Block(0, 0, 5, 3)),
+                 std::out_of_range);
+  }
+  EXPECT_EQ(S21Matrix::Load(path) == matrix, true);
+
+  S21FileMatrix file(path);
+  S21Matrix block(3, 4);
+  file.ReadBlock(2, 3, block);
+  EXPECT_EQ(block.EqMatrix(matrix.Block(2, 3, 3, 4)), true);
+  S21Matrix transposed(4, 3);
+  file.ReadBlock(2, 3, transposed.T());
+  EXPECT_EQ(transposed.EqMatrix(matrix.Block(2, 3, 3, 4).T()), true);
+  EXPECT_THROW(file.ReadBlock(7, 0, block), std::out_of_range);
+  std::remove(path.c_str());
+}
+
+TEST(OutOfCore, Subtest_1) {
+  std::string left_path = OutOfCorePath("left");
+  std::string right_path = OutOfCorePath("right");
+  std::string result_path = OutOfCorePath("product");
+  S21Matrix left = MakeMatrix(37, 23, 1);
+  S21Matrix right = MakeMatrix(23, 41, 2);
+  left.Save(left_path);
+  right.Save(right_path);
+
+  S21OutOfCore engine(5 * 64 * sizeof(double));
+  EXPECT_EQ(engine.GetMemoryBudget(), 5 * 64 * sizeof(double));
+  S21FileMatrix product = engine.Multiply(S21FileMatrix(left_path),
+                                          S21FileMatrix(right_path),
+                                          result_path);
+  EXPECT_EQ(product.GetRows(), 37);
+  EXPECT_EQ(product.GetCols(), 41);
+  EXPECT_EQ(S21Matrix::Load(result_path).EqMatrix(left * right), true);
+
+  const S21OutOfCoreStats& stats = engine.GetStats();
+  EXPECT_LE(stats.peak_buffer_bytes, engine.GetMemoryBudget());
+  EXPECT_EQ(stats.bytes_written, 37u * 41 * sizeof(double));
+  // Every tile of left is read once per column of tiles of right, and so on.
+  EXPECT_EQ(stats.bytes_read, (37u * 23 * 6 + 23u * 41 * 5) * sizeof(double));
+
+  engine.ResetStats();
+  EXPECT_EQ(engine.GetStats().bytes_read, 0u);
+  EXPECT_THROW(engine.Multiply(S21FileMatrix(left_path),
+                               S21FileMatrix(left_path), result_path),
+               std::logic_error);
+  engine.SetMemoryBudget(4 * sizeof(double));
+  EXPECT_THROW(engine.Multiply(S21FileMatrix(left_path),
+                               S21FileMatrix(right_path), result_path),
+               std::logic_error);
+  std::remove(left_path.c_str());
+  std::remove(right_path.c_str());
+  std::remove(result_path.c_str());
+}
+
+TEST(OutOfCore, Subtest_2) {
+  std::string path = OutOfCorePath("source");
+  std::string result_path = OutOfCorePath("transposed");
+  S21Matrix matrix = MakeMatrix(29, 17, 3);
+  matrix.Save(path);
+
+  S21OutOfCore engine(3 * 36 * sizeof(double));
+  S21FileMatrix transposed =
+      engine.Transpose(S21FileMatrix(path), result_path);
+  EXPECT_EQ(transposed.GetRows(), 17);
+  EXPECT_EQ(transposed.GetCols(), 29);
+  EXPECT_EQ(S21Matrix::Load(result_path) == matrix.Transpose(), true);
+  EXPECT_EQ(engine.GetStats().bytes_read, 29u * 17 * sizeof(double));
+  EXPECT_EQ(engine.GetStats().bytes_written, 29u * 17 * sizeof(double));
+  EXPECT_LE(engine.GetStats().peak_buffer_bytes, engine.GetMemoryBudget());
+  std::remove(path.c_str());
+  std::remove(result_path.c_str());
+}
+
+TEST(OutOfCore, Subtest_3) {
+  std::string left_path = OutOfCorePath("augend");
+  std::string right_path = OutOfCorePath("addend");
+  std::string result_path = OutOfCorePath("sum");
+  S21Matrix left = MakeMatrix(31, 11, 4);
+  S21Matrix right = MakeMatrix(31, 11, 5);
+  left.Save(left_path);
+  right.Save(right_path);
+
+  for (std::size_t elements : {5, 40, 1000}) {
+    S21OutOfCore engine(4 * elements * sizeof(double));
+    S21FileMatrix sum = engine.Add(S21FileMatrix(left_path),
+                                   S21FileMatrix(right_path), result_path);
+    EXPECT_EQ(S21Matrix::Load(result_path) == left + right, true);
+    EXPECT_EQ(engine.GetStats().bytes_read, 2u * 31 * 11 * sizeof(double));
+    EXPECT_LE(engine.GetStats().peak_buffer_bytes, engine.GetMemoryBudget());
+  }
+  EXPECT_THROW(S21OutOfCore().Add(S21FileMatrix(left_path),
+                                  S21FileMatrix(OutOfCorePath("missing")),
+                                  result_path),
+               std::runtime_error);
+  std::remove(left_path.c_str());
+  std::remove(right_path.c_str());
+  std::remove(result_path.c_str());
+}
+
+TEST(OutOfCore, Subtest_4) {
+  std::string path = OutOfCorePath("input");
+  std::string link_path = OutOfCorePath("input_link");
+  S21Matrix matrix = MakeMatrix(6, 6, 6);
+  matrix.Save(path);
+  std::remove(link_path.c_str());
+  ASSERT_EQ(link(path.c_str(), link_path.c_str()), 0);
+
+  S21OutOfCore engine;
+  S21FileMatrix input(path);
+  EXPECT_THROW(engine.Add(input, S21FileMatrix(path), path), std::logic_error);
+  EXPECT_THROW(engine.Multiply(S21FileMatrix(path), input, link_path),
+               std::logic_error);
+  EXPECT_THROW(engine.Transpose(input, link_path), std::logic_error);
+  EXPECT_EQ(S21Matrix::Load(path) == matrix, true);
+  std::remove(path.c_str());
+  std::remove(link_path.c_str());
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_simd.h"
+
+static const S21SimdLevel kLevels[] = {S21SimdLevel::kScalar,
+                                       S21SimdLevel::kSse2, S21SimdLevel::kAvx2,
+                                       S21SimdLevel::kAvx512};
+
+static std::vector<double> MakeValues(std::size_t size, int seed) {
+  std::vector<double> values(size);
+  for (std::size_t i = 0; i < size; i++) {
+    values[i] = static_cast<double>((i * 37 + seed * 11) % 19) - 9.5;
+  }
+  return values;
+}
+
+TEST(Simd, Subtest_1) {
+  for (S21SimdLevel level : kLevels) {
+    S21SetSimdLevel(level);
+    for (std::size_t size = 0; size < 40; size++) {
+      std::vector<double> first = MakeValues(size, 1);
+      std::vector<double> second = MakeValues(size, 2);
+      std::vector<double> sum = first, difference = first, scaled = first;
+      std::vector<double> axpy = first;
+      S21SimdAdd(sum.data(), second.data(), size);
+      S21SimdAxpy(axpy.data(), 0.25, second.data(), size);
+      S21SimdSub(difference.data(), second.data(), size);
+      S21SimdScale(scaled.data(), -1.5, size);
+      for (std::size_t i = 0; i < size; i++) {
+        ASSERT_DOUBLE_EQ(sum[i], first[i] + second[i]);
+        ASSERT_DOUBLE_EQ(difference[i], first[i] - second[i]);
+        ASSERT_DOUBLE_EQ(scaled[i], first[i] * -1.5);
+        ASSERT_DOUBLE_EQ(axpy[i], first[i] + 0.25 * second[i]);
+      }
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(Simd, Subtest_2) {
+  for (S21SimdLevel level : kLevels) {
+    S21SetSimdLevel(level);
+    for (std::size_t size = 1; size < 40; size++) {
+      std::vector<double> first = MakeValues(size, 3);
+      EXPECT_TRUE(S21SimdAllClose(first.data(), first.data(), size, 1e-7));
+      for (std::size_t i = 0; i < size; i++) {
+        std::vector<double> second = first;
+        second[i] += 1e-8;
+        EXPECT_TRUE(S21SimdAllClose(first.data(), second.data(), size, 1e-7));
+        second[i] -= 2e-6;
+        EXPECT_FALSE(S21SimdAllClose(first.data(), second.data(), size, 1e-7));
+      }
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(Simd, Subtest_3) {
+  S21SetSimdLevel(S21SimdLevel::kAvx512);
+  EXPECT_EQ(S21GetSimdLevel(), S21GetSupportedSimdLevel());
+
+  S21Matrix first(5, 7), second(5, 7);
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 7; j++) {
+      first(i, j) = i * 7 + j;
+      second(i, j) = j - i;
+    }
+  }
+  for (S21SimdLevel level : kLevels) {
+    S21SetSimdLevel(level);
+    S21Matrix result = first;
+    result.SumMatrix(second);
+    result.MulNumber(2);
+    result.SubMatrix(second);
+    for (int i = 0; i < 5; i++) {
+      for (int j = 0; j < 7; j++) {
+        EXPECT_DOUBLE_EQ(result(i, j), 2 * first(i, j) + second(i, j));
+      }
+    }
+    EXPECT_TRUE(result.EqMatrix(result));
+    EXPECT_FALSE(result.EqMatrix(first));
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(Simd, Subtest_4) {
+  for (S21SimdLevel level : kLevels) {
+    S21SetSimdLevel(level);
+    for (int rows : {3, 8, 45}) {
+      for (int cols : {2, 9, 40}) {
+        std::vector<double> source = MakeValues(rows * cols, 4);
+        std::vector<double> target(cols * rows);
+        S21SimdTranspose(rows, cols, source.data(), cols, target.data(), rows);
+        for (int i = 0; i < rows; i++) {
+          for (int j = 0; j < cols; j++) {
+            ASSERT_EQ(target[j * rows + i], source[i * cols + j]);
+          }
+        }
+      }
+    }
+    for (int size : {5, 36, 71}) {
+      std::vector<double> source = MakeValues(size * size, 5);
+      std::vector<double> target = source;
+      S21SimdTransposeInPlace(size, target.data(), size);
+      for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+          ASSERT_EQ(target[j * size + i], source[i * size + j]);
+        }
+      }
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
+
+TEST(Simd, Subtest_5) {
+  for (S21SimdLevel level : kLevels) {
+    S21SetSimdLevel(level);
+    for (std::size_t size = 0; size < 40; size++) {
+      std::vector<double> first = MakeValues(size, 6);
+      std::vector<double> second = MakeValues(size, 7);
+      std::vector<double> sum(size), difference(size), scaled(size);
+      S21SimdAddInto(sum.data(), first.data(), second.data(), size);
+      S21SimdSubInto(difference.data(), first.data(), second.data(), size);
+      S21SimdScaleInto(scaled.data(), 0.75, first.data(), size);
+      for (std::size_t i = 0; i < size; i++) {
+        ASSERT_DOUBLE_EQ(sum[i], first[i] + second[i]);
+        ASSERT_DOUBLE_EQ(difference[i], first[i] - second[i]);
+        ASSERT_DOUBLE_EQ(scaled[i], first[i] * 0.75);
+      }
+    }
+  }
+  S21SetSimdLevel(S21GetSupportedSimdLevel());
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../s21_sparse_matrix.h"
+#include "../s21_thread_pool.h"
+#include "s21_test_helpers.h"
+
+static S21Matrix MakeSparseDense(int rows, int cols, int seed) {
+  S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if ((i * 7 + j * 13 + seed) % 9 == 0) {
+        matrix(i, j) = TestValue(i, j, seed);
+      }
+    }
+  }
+  return matrix;
+}
+
+TEST(SparseMatrix, Subtest_1) {
+  S21Matrix dense = MakeSparseDense(7, 5, 1);
+  S21SparseMatrix sparse(dense);
+  EXPECT_EQ(sparse.GetRows(), 7);
+  EXPECT_EQ(sparse.GetCols(), 5);
+  EXPECT_EQ(sparse.ToDense().EqMatrix(dense), true);
+
+  int non_zeros = 0;
+  for (int i = 0; i < 7; i++) {
+    for (int j = 0; j < 5; j++) {
+      EXPECT_EQ(sparse.Get(i, j), dense(i, j));
+      non_zeros += dense(i, j) != 0;
+    }
+  }
+  EXPECT_EQ(sparse.GetNonZeros(), non_zeros);
+  EXPECT_EQ(sparse.GetRowOffsets().back(), non_zeros);
+  EXPECT_THROW(sparse.Get(7, 0), std::out_of_range);
+
+  S21SparseMatrix rounded(dense, 1.0);
+  for (double value : rounded.GetValues()) EXPECT_GT(fabs(value), 1.0);
+  EXPECT_THROW(S21SparseMatrix(0, 3), std::logic_error);
+}
+
+TEST(SparseMatrix, Subtest_2) {
+  S21SparseMatrix sparse = S21SparseMatrix::FromEntries(
+      3, 4, {{2, 1, 1.5}, {0, 3, 2}, {2, 1, 0.5}, {0, 0, -1}});
+  EXPECT_EQ(sparse.GetNonZeros(), 3);
+  EXPECT_EQ(sparse.Get(2, 1), 2);
+  EXPECT_EQ(sparse.GetColIndices(), (std::vector<int>{0, 3, 1}));
+  EXPECT_EQ(sparse.GetRowOffsets(), (std::vector<int>{0, 2, 2, 3}));
+  EXPECT_THROW(S21SparseMatrix::FromEntries(3, 4, {{3, 0, 1}}),
+               std::out_of_range);
+
+  S21SparseMatrix built(3, 4, {0, 2, 2, 3}, {0, 3, 1}, {-1, 2, 2});
+  EXPECT_EQ(built.EqMatrix(sparse), true);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {0, 2, 2, 3}, {3, 0, 1}, {-1, 2, 2}),
+               std::logic_error);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {0, 2, 3}, {0, 3, 1}, {-1, 2, 2}),
+               std::logic_error);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {0, 2, 2, 3}, {0, 4, 1}, {-1, 2, 2}),
+               std::logic_error);
+}
+
+TEST(SparseMatrix, Subtest_3) {
+  S21Matrix first = MakeSparseDense(9, 6, 2);
+  S21Matrix second = MakeSparseDense(9, 6, 5);
+  S21SparseMatrix sparse_first(first), sparse_second(second);
+
+  EXPECT_EQ((sparse_first + sparse_second).ToDense().EqMatrix(first + second),
+            true);
+  EXPECT_EQ((sparse_first - sparse_second).ToDense().EqMatrix(first - second),
+            true);
+  S21SparseMatrix zero = sparse_first - sparse_first;
+  EXPECT_EQ(zero.GetNonZeros(), 0);
+  EXPECT_EQ(sparse_first.Transpose().ToDense().EqMatrix(first.Transpose()),
+            true);
+  EXPECT_EQ(sparse_first.Transpose().Transpose().EqMatrix(sparse_first), true);
+  EXPECT_EQ(sparse_first.EqMatrix(sparse_second), false);
+
+  sparse_first.MulNumber(-2);
+  EXPECT_EQ(sparse_first.ToDense().EqMatrix(first * -2.0), true);
+  EXPECT_THROW(sparse_first.SumMatrix(sparse_first.Transpose()),
+               std::logic_error);
+}
+
+TEST(SparseMatrix, Subtest_4) {
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int threads = pool.GetThreadCount();
+  for (int thread_count : {1, 4}) {
+    pool.SetThreadCount(thread_count);
+    S21Matrix dense = MakeSparseDense(300, 200, 3);
+    S21Matrix other = MakeSparseDense(200, 70, 4);
+    S21SparseMatrix sparse(dense);
+
+    EXPECT_EQ((sparse * other).EqMatrix(dense * other), true);
+    EXPECT_EQ(sparse.MulDense(dense.T().Block(0, 0, 200, 1))
+                  .EqMatrix(dense * S21Matrix(dense.T().Block(0, 0, 200, 1))),
+              true);
+
+    std::vector<double> vector(200);
+    S21Matrix column(200, 1);
+    for (int i = 0; i < 200; i++) column(i, 0) = vector[i] = i % 7 - 3;
+    std::vector<double> product = sparse * vector;
+    S21Matrix expected = dense * column;
+    for (int i = 0; i < 300; i++) EXPECT_NEAR(product[i], expected(i, 0), 1e-9);
+  }
+  pool.SetThreadCount(threads);
+
+  S21SparseMatrix sparse(3, 4);
+  EXPECT_THROW(sparse * S21Matrix(3, 4), std::logic_error);
+  EXPECT_THROW(sparse * std::vector<double>(3), std::logic_error);
+}
+
+TEST(SparseMatrix, Subtest_5) {
+  EXPECT_THROW(S21SparseMatrix(2, 4, {0, 5, 2}, {0, 1}, {1, 2}),
+               std::logic_error);
+  EXPECT_THROW(S21SparseMatrix(2, 4, {0, -1, 2}, {0, 1}, {1, 2}),
+               std::logic_error);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {0, 2, 1, 2}, {0, 1}, {1, 2}),
+               std::logic_error);
+  S21SparseMatrix valid(2, 4, {0, 0, 2}, {0, 1}, {1, 2});
+  EXPECT_EQ(valid.Get(1, 1), 2);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "../s21_matrix_arena.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_strassen.h"
+#include "s21_test_helpers.h"
+
+// Irrational entries of varying magnitude, so that the products actually
+// round and the error bound below is exercised; quarter-step MakeMatrix
+// entries would multiply exactly.
+static S21Matrix MakeRoundingMatrix(int rows, int cols, int seed) {
+  S21Matrix matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      matrix(i, j) = std::sin(i * 1.3 + j * 0.7 + seed) * (1 + (i + j) % 5);
+    }
+  }
+  return matrix;
+}
+
+static double MaxAbs(const S21Matrix& matrix) {
+  double result = 0;
+  for (int i = 0; i < matrix.GetRows(); i++) {
+    for (int j = 0; j < matrix.GetCols(); j++) {
+      result = std::max(result, std::fabs(matrix(i, j)));
+    }
+  }
+  return result;
+}
+
+static double MaxDifference(const S21Matrix& first, const S21Matrix& second) {
+  S21Matrix difference(first);
+  difference.SubMatrix(second);
+  return MaxAbs(difference);
+}
+
+// Higham, Accuracy and Stability of Numerical Algorithms, theorem 23.3:
+// Winograd's variant with n = 2^k * n0 and classic products of size n0.
+static double WinogradBound(int size, int cutoff, double left, double right) {
+  double levels = static_cast<double>(size) / cutoff;
+  double growth = std::pow(levels, std::log2(18.0));
+  double eps = std::numeric_limits<double>::epsilon() / 2;
+  return (growth * (cutoff * cutoff + 6.0 * cutoff) - 6.0 * size) * eps *
+         left * right;
+}
+
+TEST(Strassen, Subtest_1) {
+  S21Matrix first = MakeRoundingMatrix(128, 128, 1);
+  S21Matrix second = MakeRoundingMatrix(128, 128, 2);
+  S21Matrix classic = first * second;
+  double left = MaxAbs(first), right = MaxAbs(second);
+  double classic_bound =
+      128 * std::numeric_limits<double>::epsilon() * left * right;
+  for (int cutoff : {8, 16, 32}) {
+    double error = MaxDifference(S21StrassenMultiply(first, second, cutoff),
+                                 classic);
+    EXPECT_LE(error, WinogradBound(128, cutoff, left, right) + classic_bound);
+    EXPECT_LE(error, 1e-11 * 128 * left * right);
+  }
+}
+
+TEST(Strassen, Subtest_2) {
+  for (int rows : {1, 17, 37}) {
+    for (int inner : {1, 23, 53}) {
+      for (int cols : {1, 29, 64}) {
+        S21Matrix first = MakeMatrix(rows, inner, 3);
+        S21Matrix second = MakeMatrix(inner, cols, 4);
+        S21Matrix result = S21StrassenMultiply(first, second, 4);
+        EXPECT_LE(MaxDifference(result, first * second), 1e-11);
+      }
+    }
+  }
+}
+
+TEST(Strassen, Subtest_3) {
+  S21Matrix first = MakeMatrix(40, 70, 5);
+  S21Matrix second = MakeMatrix(70, 50, 6);
+  EXPECT_EQ(S21StrassenMultiply(first, second).EqMatrix(first * second), true);
+  EXPECT_EQ(S21StrassenWorkspaceSize(40, 50, 70, 40), 0u);
+  EXPECT_EQ(S21StrassenWorkspaceSize(64, 64, 64, 16),
+            3u * 32 * 32 + 3u * 16 * 16);
+}
+
+TEST(Strassen, Subtest_4) {
+  S21Matrix first = MakeMatrix(96, 96, 7);
+  S21Matrix second = MakeMatrix(96, 96, 8);
+  S21Matrix expected = S21StrassenMultiply(first, second, 8);
+  S21MatrixArena arena;
+  {
+    S21MatrixArenaScope scope(arena);
+    S21Matrix result = S21StrassenMultiply(first, second, 8);
+    EXPECT_EQ(arena.GetBytesInUse(), 96u * 96 * sizeof(double));
+    EXPECT_EQ(result.EqMatrix(expected), true);
+  }
+}
+
+TEST(Strassen, Subtest_5) {
+  S21Matrix first(2, 3), second(2, 3);
+  EXPECT_THROW(S21StrassenMultiply(first, second), std::logic_error);
+  S21Matrix third(3, 2);
+  EXPECT_THROW(S21StrassenMultiply(first, third, 0), std::logic_error);
+}
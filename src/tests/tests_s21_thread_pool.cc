@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_thread_pool.h"
+
+TEST(ThreadPool, Subtest_1) {
+  S21ThreadPool pool(4);
+  EXPECT_EQ(pool.GetThreadCount(), 4);
+
+  std::vector<std::atomic<int>> visits(1000);
+  for (int run = 0; run < 10; run++) {
+    pool.ParallelFor(1000, [&](int i) { visits[i]++; });
+  }
+  for (const std::atomic<int>& count : visits) EXPECT_EQ(count.load(), 10);
+}
+
+TEST(ThreadPool, Subtest_2) {
+  S21ThreadPool pool(3);
+  pool.SetThreadCount(1);
+  EXPECT_EQ(pool.GetThreadCount(), 1);
+  pool.SetThreadCount(5);
+  EXPECT_EQ(pool.GetThreadCount(), 5);
+
+  std::atomic<int> sum(0);
+  pool.ParallelFor(100, [&](int i) { sum += i; });
+  EXPECT_EQ(sum.load(), 4950);
+
+  EXPECT_ANY_THROW(pool.SetThreadCount(0));
+  EXPECT_ANY_THROW(S21ThreadPool invalid_pool(-1));
+}
+
+TEST(ThreadPool, Subtest_3) {
+  S21ThreadPool pool(4);
+  EXPECT_THROW(pool.ParallelFor(64,
+                                [](int i) {
+                                  if (i == 17) throw std::out_of_range("17");
+                                }),
+               std::out_of_range);
+
+  std::atomic<int> nested(0);
+  pool.ParallelFor(8, [&](int) {
+    pool.ParallelFor(8, [&](int) { nested++; });
+  });
+  EXPECT_EQ(nested.load(), 64);
+}
+
+TEST(ThreadPool, Subtest_4) {
+  S21Matrix first(260, 300), second(300, 140);
+  for (int i = 0; i < first.GetRows(); i++) {
+    for (int j = 0; j < first.GetCols(); j++) first(i, j) = (i + 2 * j) % 9;
+  }
+  for (int i = 0; i < second.GetRows(); i++) {
+    for (int j = 0; j < second.GetCols(); j++) second(i, j) = (3 * i - j) % 7;
+  }
+
+  S21ThreadPool& pool = S21ThreadPool::Global();
+  int thread_count = pool.GetThreadCount();
+  pool.SetThreadCount(1);
+  S21Matrix serial = first * second;
+  pool.SetThreadCount(4);
+  S21Matrix parallel = first * second;
+  S21Matrix parallel_transposed = second.Transpose() * first.Transpose();
+  pool.SetThreadCount(thread_count);
+
+  EXPECT_EQ(serial.EqMatrix(parallel), true);
+  EXPECT_EQ(serial.Transpose().EqMatrix(parallel_transposed), true);
+}
+
+TEST(ThreadPool, Subtest_5) {
+  S21ThreadPool pool(2);
+  std::atomic<bool> done(false);
+  std::thread reader([&] {
+    while (!done) {
+      int count = pool.GetThreadCount();
+      EXPECT_GE(count, 1);
+      EXPECT_LE(count, 4);
+    }
+  });
+  for (int i = 0; i < 50; i++) pool.SetThreadCount(i % 4 + 1);
+  done = true;
+  reader.join();
+  EXPECT_EQ(pool.GetThreadCount(), 2);
+}